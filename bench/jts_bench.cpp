@@ -0,0 +1,446 @@
+// jts_bench: sürümler arası karşılaştırma için tekrarlanabilir mikro ölçümler
+//
+// registry/register/<n>        : n görevi tek tek kaydet (ns / görev)
+// registry/register_bulk/<n>   : aynısı registerTasks ile (tek kilit)
+// registry/pop/<n>             : n görev hazırken acquireNext + complete (ns / seçim)
+// pool/submit_to_run/<t>       : ThreadPool submit -> iş başlangıcı (ns, boşta havuz)
+// pool/submit_to_run_spin/<t>  : aynısı, worker'lar park etmeden önce 50 us döner
+// pool/throughput/<t>          : kısa işler, t thread (ns / iş, items_per_second)
+// scheduler/wakeup/<w>         : addTask -> work() başlangıcı (w=0: tek thread modu)
+// metrics/record[_named]       : recordStart + recordEnd çifti (ns)
+//
+// Her ölçüm --repetitions kez tekrarlanır, real_time'ı ortanca olan tekrar
+// raporlanır. Tohumlar ve iterasyon sayıları sabittir.
+//
+// JSON, google-benchmark çıktısıyla aynı alanları taşır (context +
+// benchmarks[name, iterations, real_time, cpu_time, time_unit, sayaçlar]);
+// compare.py gibi araçlarla iki sürüm karşılaştırılabilir.
+//
+// Kullanım: jts_bench [--filter=alt_dizge] [--repetitions=N] [--out=dosya.json] [--json]
+//   --out  : tablo ekrana, JSON dosyaya
+//   --json : JSON standart çıktıya (tablo yok)
+#include "task_registry.hpp"
+#include "thread_pool.hpp"
+#include "scheduler.hpp"
+#include "metrics.hpp"
+#include "topology.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Linux headers
+#include <unistd.h>
+
+#ifndef JTS_VERSION
+#define JTS_VERSION "unknown"
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Derleyicinin ölçülen işi atmasını önle
+volatile uint64_t sink = 0;
+
+int64_t threadCpuNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+// Tek tekrarın sonucu (süreler iterasyon başına ns)
+struct Sample {
+    uint64_t iterations = 0;
+    double realNs = 0;
+    double cpuNs = 0;
+    std::vector<std::pair<std::string, double>> counters;
+};
+
+// Ölçülen bölgenin duvar ve (ölçen thread'in) CPU süresi
+class Timer {
+public:
+    Timer() : wall_(Clock::now()), cpu_(threadCpuNs()) {}
+
+    Sample finish(uint64_t iterations) const {
+        Sample s;
+        s.iterations = iterations;
+        double wall = std::chrono::duration<double, std::nano>(Clock::now() - wall_).count();
+        s.realNs = wall / iterations;
+        s.cpuNs = static_cast<double>(threadCpuNs() - cpu_) / iterations;
+        s.counters.emplace_back("items_per_second", iterations / (wall * 1e-9));
+        return s;
+    }
+
+private:
+    Clock::time_point wall_;
+    int64_t cpu_;
+};
+
+struct Benchmark {
+    std::string name;
+    std::function<Sample()> run;
+};
+
+struct Result {
+    std::string name;
+    size_t repetitions;
+    Sample median;
+};
+
+double percentile(std::vector<double>& v, double p) {
+    std::sort(v.begin(), v.end());
+    return v[static_cast<size_t>(p * (v.size() - 1))];
+}
+
+// Gecikme örneklerinden Sample: real_time ortalama, sayaçlar p50/p99/max
+Sample latencySample(std::vector<double> ns, double cpuNs) {
+    Sample s;
+    s.iterations = ns.size();
+    double sum = 0;
+    for (double v : ns) sum += v;
+    s.realNs = sum / ns.size();
+    s.cpuNs = cpuNs / ns.size();
+    s.counters.emplace_back("p50_ns", percentile(ns, 0.50));
+    s.counters.emplace_back("p99_ns", percentile(ns, 0.99));
+    s.counters.emplace_back("max_ns", ns.back());
+    return s;
+}
+
+void tinyWork() {
+    volatile unsigned x = 0;
+    for (unsigned i = 0; i < 64; ++i) x = x + i;
+}
+
+// Sabit tohumla n adet rastgele öncelikli görev
+std::vector<jts::Task> makeTasks(size_t n, bool periodic) {
+    std::mt19937 rng(1);
+    std::vector<jts::Task> tasks(n);
+    for (auto& t : tasks) {
+        t.name = "task";
+        t.priority = static_cast<int>(rng() % 11);
+        t.realtime = rng() % 16 == 0;
+        if (periodic) t.period = std::chrono::milliseconds(1);
+        t.work = []() {};
+    }
+    return tasks;
+}
+
+// --- registry ---
+
+Sample registryRegister(size_t n) {
+    std::vector<jts::Task> tasks = makeTasks(n, false);
+    jts::TaskRegistry reg;
+    Timer timer;
+    for (auto& t : tasks) reg.registerTask(std::move(t));
+    return timer.finish(n);
+}
+
+Sample registryRegisterBulk(size_t n) {
+    std::vector<jts::Task> tasks = makeTasks(n, false);
+    jts::TaskRegistry reg;
+    Timer timer;
+    reg.registerTasks(std::move(tasks));
+    return timer.finish(n);
+}
+
+Sample registryPop(size_t n) {
+    jts::TaskRegistry reg;
+    reg.reserve(n);
+    reg.registerTasks(makeTasks(n, true));  // Periyodik: complete() geri koyar
+
+    const size_t iters = 200000;
+    Timer timer;
+    for (size_t k = 0; k < iters; ++k) {
+        jts::ScheduledTask* task = reg.acquireNext();
+        sink = sink + task->id;
+        task->release_time += task->period;  // Geçmişte kalır: hemen hazır
+        reg.complete(task);
+    }
+    return timer.finish(iters);
+}
+
+// --- ThreadPool ---
+
+Sample poolSubmitToRun(size_t threads, std::chrono::microseconds spin) {
+    jts::PoolOptions options;
+    options.minThreads = threads;
+    options.spin = spin;
+    jts::ThreadPool pool(options);
+    const size_t samples = 2000;
+    std::vector<double> ns;
+    ns.reserve(samples);
+
+    int64_t cpu0 = threadCpuNs();
+    for (size_t i = 0; i < samples; ++i) {
+        std::atomic<bool> done{false};
+        Clock::time_point started;
+        auto t0 = Clock::now();
+        pool.submit([&]() {
+            started = Clock::now();
+            done.store(true, std::memory_order_release);
+        });
+        while (!done.load(std::memory_order_acquire)) std::this_thread::yield();
+        ns.push_back(std::chrono::duration<double, std::nano>(started - t0).count());
+    }
+    return latencySample(std::move(ns), static_cast<double>(threadCpuNs() - cpu0));
+}
+
+Sample poolThroughput(size_t threads) {
+    jts::ThreadPool pool(threads);
+    const size_t jobs = 100000;
+    Timer timer;
+    for (size_t i = 0; i < jobs; ++i) pool.submit(tinyWork);
+    pool.waitIdle();
+    return timer.finish(jobs);
+}
+
+// --- Scheduler ---
+
+Sample schedulerWakeup(size_t workers) {
+    std::unique_ptr<jts::Scheduler> s = workers == 0
+        ? std::make_unique<jts::Scheduler>()
+        : std::make_unique<jts::Scheduler>(workers);
+    s->start();
+
+    // Worker'ın gerçekten boşta beklemesi için örnekler arasında boşluk
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> gapUs(200, 1000);
+    const size_t samples = 200;
+    std::vector<double> ns;
+    ns.reserve(samples);
+
+    int64_t cpu0 = threadCpuNs();
+    for (size_t i = 0; i < samples; ++i) {
+        std::this_thread::sleep_for(std::chrono::microseconds(gapUs(rng)));
+        std::atomic<bool> done{false};
+        Clock::time_point started;
+        jts::Task t;
+        t.name = "probe";
+        auto t0 = Clock::now();
+        s->addTask(std::move(t), [&]() {
+            started = Clock::now();
+            done.store(true, std::memory_order_release);
+        });
+        while (!done.load(std::memory_order_acquire)) std::this_thread::yield();
+        ns.push_back(std::chrono::duration<double, std::nano>(started - t0).count());
+    }
+    double cpu = static_cast<double>(threadCpuNs() - cpu0);
+    s->stop();
+    return latencySample(std::move(ns), cpu);
+}
+
+// --- MetricsCollector ---
+
+Sample metricsRecord(bool byName) {
+    // Halka tamponu (4096) dolmasın: yarısı kadarlık patlamalar, aralarında
+    // toplayıcının boşaltması beklenir (bekleme ölçüme girmez)
+    jts::MetricsCollector metrics(10000, std::chrono::milliseconds(1));
+    const std::string name = "camera_capture";
+    const uint32_t nameId = metrics.internName(name);
+    const size_t burst = 2048;
+    const size_t iters = 100 * burst;
+
+    double wallNs = 0;
+    int64_t cpuNs = 0;
+    for (size_t done = 0; done < iters; done += burst) {
+        auto t0 = Clock::now();
+        int64_t c0 = threadCpuNs();
+        for (size_t i = done; i < done + burst; ++i) {
+            jts::MetricsToken token = byName ? metrics.recordStart(i, name)
+                                             : metrics.recordStart(i, nameId);
+            metrics.recordEnd(token, true);
+        }
+        cpuNs += threadCpuNs() - c0;
+        wallNs += std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+
+    Sample s;
+    s.iterations = iters;
+    s.realNs = wallNs / iters;
+    s.cpuNs = static_cast<double>(cpuNs) / iters;
+    s.counters.emplace_back("items_per_second", iters / (wallNs * 1e-9));
+    s.counters.emplace_back("dropped", static_cast<double>(metrics.dropped()));
+    return s;
+}
+
+std::vector<Benchmark> allBenchmarks() {
+    std::vector<Benchmark> out;
+    for (size_t n : {size_t(1000), size_t(10000), size_t(100000)}) {
+        out.push_back({"registry/register/" + std::to_string(n), [n]() { return registryRegister(n); }});
+        out.push_back({"registry/register_bulk/" + std::to_string(n), [n]() { return registryRegisterBulk(n); }});
+        out.push_back({"registry/pop/" + std::to_string(n), [n]() { return registryPop(n); }});
+    }
+
+    std::vector<size_t> threads = {1, 2, 4, jts::Topology::system().size()};
+    std::sort(threads.begin(), threads.end());
+    threads.erase(std::unique(threads.begin(), threads.end()), threads.end());
+    for (size_t t : threads) {
+        out.push_back({"pool/submit_to_run/" + std::to_string(t), [t]() {
+            return poolSubmitToRun(t, std::chrono::microseconds(0));
+        }});
+        out.push_back({"pool/submit_to_run_spin/" + std::to_string(t), [t]() {
+            return poolSubmitToRun(t, std::chrono::microseconds(50));
+        }});
+    }
+    for (size_t t : threads) {
+        out.push_back({"pool/throughput/" + std::to_string(t), [t]() { return poolThroughput(t); }});
+    }
+
+    out.push_back({"scheduler/wakeup/0", []() { return schedulerWakeup(0); }});
+    out.push_back({"scheduler/wakeup/2", []() { return schedulerWakeup(2); }});
+
+    out.push_back({"metrics/record", []() { return metricsRecord(false); }});
+    out.push_back({"metrics/record_named", []() { return metricsRecord(true); }});
+    return out;
+}
+
+Result runBenchmark(const Benchmark& b, size_t repetitions) {
+    std::vector<Sample> samples;
+    for (size_t r = 0; r < repetitions; ++r) samples.push_back(b.run());
+    std::sort(samples.begin(), samples.end(),
+              [](const Sample& a, const Sample& c) { return a.realNs < c.realNs; });
+    return {b.name, repetitions, samples[samples.size() / 2]};
+}
+
+// --- Çıktı ---
+
+std::string jsonString(const std::string& s) {
+    std::string out = "\"";
+    for (char ch : s) {
+        unsigned char c = static_cast<unsigned char>(ch);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += ch;
+        } else if (c < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out += buf;
+        } else {
+            out += ch;
+        }
+    }
+    return out + "\"";
+}
+
+void writeJson(std::ostream& out, const std::vector<Result>& results, const char* executable) {
+    char host[256] = {0};
+    gethostname(host, sizeof(host) - 1);
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", std::localtime(&now));
+#ifdef NDEBUG
+    const char* buildType = "release";
+#else
+    const char* buildType = "debug";
+#endif
+
+    out << std::setprecision(10);
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": " << jsonString(date) << ",\n"
+        << "    \"host_name\": " << jsonString(host) << ",\n"
+        << "    \"executable\": " << jsonString(executable) << ",\n"
+        << "    \"num_cpus\": " << jts::Topology::system().size() << ",\n"
+        << "    \"cache_groups\": " << jts::Topology::system().cacheGroups().size() << ",\n"
+        << "    \"library_version\": " << jsonString(JTS_VERSION) << ",\n"
+        << "    \"library_build_type\": " << jsonString(buildType) << "\n"
+        << "  },\n  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result& r = results[i];
+        out << (i ? ",\n" : "\n")
+            << "    {\n"
+            << "      \"name\": " << jsonString(r.name) << ",\n"
+            << "      \"run_name\": " << jsonString(r.name) << ",\n"
+            << "      \"run_type\": \"iteration\",\n"
+            << "      \"repetitions\": " << r.repetitions << ",\n"
+            << "      \"iterations\": " << r.median.iterations << ",\n"
+            << "      \"real_time\": " << r.median.realNs << ",\n"
+            << "      \"cpu_time\": " << r.median.cpuNs << ",\n"
+            << "      \"time_unit\": \"ns\"";
+        for (const auto& c : r.median.counters) {
+            out << ",\n      " << jsonString(c.first) << ": " << c.second;
+        }
+        out << "\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void printRow(const Result& r) {
+    std::cout << std::left << std::setw(32) << r.name << std::right
+              << std::fixed << std::setprecision(1)
+              << std::setw(14) << r.median.realNs
+              << std::setw(14) << r.median.cpuNs
+              << std::setw(12) << r.median.iterations;
+    for (const auto& c : r.median.counters) {
+        std::cout << "  " << c.first << "=" << std::setprecision(0) << c.second;
+    }
+    std::cout << "\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter;
+    std::string outPath;
+    bool jsonStdout = false;
+    size_t repetitions = 5;
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strncmp(arg, "--filter=", 9) == 0) {
+            filter = arg + 9;
+        } else if (std::strncmp(arg, "--out=", 6) == 0) {
+            outPath = arg + 6;
+        } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+            repetitions = std::max(1, std::atoi(arg + 14));
+        } else if (std::strcmp(arg, "--json") == 0) {
+            jsonStdout = true;
+        } else {
+            std::cerr << "Kullanım: " << argv[0]
+                      << " [--filter=alt_dizge] [--repetitions=N] [--out=dosya.json] [--json]\n";
+            return 2;
+        }
+    }
+
+    // Scheduler/havuz logları ölçümü ve tabloyu bozmasın
+    jts::Logger::instance().setLevel(jts::LogLevel::Warn);
+
+    if (!jsonStdout) {
+        std::cout << std::left << std::setw(32) << "benchmark" << std::right
+                  << std::setw(14) << "real ns" << std::setw(14) << "cpu ns"
+                  << std::setw(12) << "iters" << "\n";
+    }
+
+    std::vector<Result> results;
+    for (const Benchmark& b : allBenchmarks()) {
+        if (!filter.empty() && b.name.find(filter) == std::string::npos) continue;
+        results.push_back(runBenchmark(b, repetitions));
+        if (!jsonStdout) printRow(results.back());
+    }
+
+    if (jsonStdout) writeJson(std::cout, results, argv[0]);
+    if (!outPath.empty()) {
+        std::ofstream out(outPath);
+        if (!out) {
+            std::cerr << "Yazılamadı: " << outPath << "\n";
+            return 1;
+        }
+        writeJson(out, results, argv[0]);
+    }
+    return 0;
+}
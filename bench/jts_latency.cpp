@@ -0,0 +1,283 @@
+// jts_latency: periyodik görevlerin uyanma gecikmesi ve jitter'ı (cyclictest benzeri)
+//
+// Scheduler'a --tasks adet periyodik ölçüm görevi eklenir. Her aktivasyonda
+// gecikme = başlangıç anı - hedeflenen aktivasyon anı (ilk aktivasyon +
+// k * periyot; scheduler kaymasız yeniden kurar). İsteğe bağlı olarak bir
+// ThreadPool'da CPU + bellek yükü üretilir.
+//
+// Görevi çalıştıran thread ilk aktivasyonda yapılandırılır (cpu_utils):
+//   --pin=LİSTE   setCurrentThreadAffinity (ör. 2 veya 2-3); yoksa sabitlenmez
+//   --fifo[=PRI]  setRealtimeScheduling (varsayılan 80); yoksa SCHED_OTHER
+// Yetki yoksa uyarı basılır ve ölçüm varsayılan ayarlarla sürer.
+//
+// Kullanım: jts_latency [--interval=US] [--loops=N] [--tasks=N] [--workers=N]
+//                       [--load=N] [--load-cpus=LİSTE] [--pin=LİSTE] [--fifo[=PRI]]
+//                       [--hist=US] [--max=US]
+//   --workers : 0 = tek thread modu (varsayılan), N = çoklu worker
+//   --hist    : 1 us'lik kovalarla histogram üst sınırı (0 = basma)
+//   --max     : en büyük gecikme bunu aşarsa çıkış kodu 1 (kart doğrulaması)
+#include "scheduler.hpp"
+#include "thread_pool.hpp"
+#include "histogram.hpp"
+#include "cpu_utils.hpp"
+#include "topology.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Options {
+    int64_t intervalUs = 1000;
+    uint64_t loops = 10000;
+    size_t tasks = 1;
+    size_t workers = 0;
+    size_t load = 0;
+    std::vector<int> loadCpus;
+    std::vector<int> pin;
+    bool fifo = false;
+    int fifoPriority = 80;
+    int64_t histUs = 200;
+    int64_t maxUs = -1;
+};
+
+// Bir ölçüm görevinin durumu (aktivasyonlar sıralı: tek yazıcı)
+struct Probe {
+    Clock::time_point base;  // Hedeflenen ilk aktivasyon
+    std::chrono::microseconds period{0};
+    uint64_t activations = 0;
+    std::atomic<uint64_t> done{0};  // Ana thread ilerlemeyi buradan okur
+    int64_t minNs = INT64_MAX;
+    uint64_t overruns = 0;  // Gecikme bir periyodu aştı
+    jts::LatencyHistogram hist;
+    std::vector<uint64_t> linear;  // 1 us kovalar + taşma
+};
+
+// İlk aktivasyonda çalıştıran thread'in ayarları (thread başına bir kez)
+std::atomic<bool> pinFailed{false};
+std::atomic<bool> fifoFailed{false};
+
+void configureThread(const Options& opt) {
+    thread_local bool configured = false;
+    if (configured) return;
+    configured = true;
+    if (!opt.pin.empty() && !jts::setCurrentThreadAffinity(opt.pin)) pinFailed = true;
+    if (opt.fifo) {
+        if (!jts::setRealtimeScheduling(opt.fifoPriority)) fifoFailed = true;
+    } else {
+        jts::setNormalScheduling();
+    }
+}
+
+void activate(Probe& p, const Options& opt) {
+    auto now = Clock::now();
+    configureThread(opt);
+
+    auto intended = p.base + p.period * p.activations;
+    int64_t ns = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                          now - intended).count());
+    p.activations++;
+    p.hist.record(ns);
+    p.minNs = std::min(p.minNs, ns);
+    if (ns > std::chrono::duration_cast<std::chrono::nanoseconds>(p.period).count()) {
+        p.overruns++;
+    }
+    size_t bucket = static_cast<size_t>(ns / 1000);
+    p.linear[std::min(bucket, p.linear.size() - 1)]++;
+    p.done.store(p.activations, std::memory_order_release);
+}
+
+// Arka plan yükü: hesap + önbelleği taşıran bellek taraması, stop'a kadar
+void loadLoop(const std::atomic<bool>& stop, const std::vector<int>& cpus) {
+    if (!cpus.empty()) jts::setCurrentThreadAffinity(cpus);
+    std::vector<uint64_t> buffer(1 << 20);  // 8 MB
+    uint64_t x = 1;
+    while (!stop.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < 100000; ++i) x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+        for (size_t i = 0; i < buffer.size(); i += 8) buffer[i] += x;  // 64 baytlık adım
+    }
+    volatile uint64_t sink = buffer[x % buffer.size()];
+    (void)sink;
+}
+
+bool parseArgs(int argc, char** argv, Options& opt) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&arg](const char* key) -> const char* {
+            size_t n = std::strlen(key);
+            return arg.compare(0, n, key) == 0 ? arg.c_str() + n : nullptr;
+        };
+        const char* v;
+        if ((v = value("--interval="))) {
+            opt.intervalUs = std::max(1L, std::atol(v));
+        } else if ((v = value("--loops="))) {
+            opt.loops = std::max(1L, std::atol(v));
+        } else if ((v = value("--tasks="))) {
+            opt.tasks = std::max(1L, std::atol(v));
+        } else if ((v = value("--workers="))) {
+            opt.workers = std::max(0L, std::atol(v));
+        } else if ((v = value("--load-cpus="))) {
+            opt.loadCpus = jts::parseCpuList(v);
+        } else if ((v = value("--load="))) {
+            opt.load = std::max(0L, std::atol(v));
+        } else if ((v = value("--pin="))) {
+            opt.pin = jts::parseCpuList(v);
+            if (opt.pin.empty()) return false;
+        } else if (arg == "--fifo") {
+            opt.fifo = true;
+        } else if ((v = value("--fifo="))) {
+            opt.fifo = true;
+            opt.fifoPriority = std::min(99, std::max(1, std::atoi(v)));
+        } else if ((v = value("--hist="))) {
+            opt.histUs = std::max(0L, std::atol(v));
+        } else if ((v = value("--max="))) {
+            opt.maxUs = std::atol(v);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string cpuListText(const std::vector<int>& cpus) {
+    if (cpus.empty()) return "yok";
+    std::string out;
+    for (int c : cpus) {
+        if (!out.empty()) out += ',';
+        out += std::to_string(c);
+    }
+    return out;
+}
+
+void printRow(const std::string& label, uint64_t count, int64_t minNs,
+              const jts::LatencyHistogram& h, uint64_t overruns) {
+    std::cout << std::left << std::setw(5) << label << std::right << std::fixed
+              << " act=" << std::setw(7) << count
+              << "  min=" << std::setw(6) << minNs / 1000
+              << "  avg=" << std::setw(8) << std::setprecision(1) << h.mean() / 1000.0
+              << "  p99=" << std::setw(6) << h.percentile(99) / 1000
+              << "  max=" << std::setw(6) << h.max() / 1000
+              << "  overrun=" << overruns << "  (us)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options opt;
+    if (!parseArgs(argc, argv, opt)) {
+        std::cerr << "Kullanım: " << argv[0]
+                  << " [--interval=US] [--loops=N] [--tasks=N] [--workers=N] [--load=N]"
+                     " [--load-cpus=LİSTE] [--pin=LİSTE] [--fifo[=PRI]] [--hist=US] [--max=US]\n";
+        return 2;
+    }
+
+    // Scheduler logları ölçümü bozmasın
+    jts::Logger::instance().setLevel(jts::LogLevel::Warn);
+
+    std::cout << "jts_latency: interval=" << opt.intervalUs << "us loops=" << opt.loops
+              << " tasks=" << opt.tasks << " workers=" << opt.workers
+              << " load=" << opt.load << " pin=" << cpuListText(opt.pin)
+              << " policy=" << (opt.fifo ? "SCHED_FIFO(" + std::to_string(opt.fifoPriority) + ")"
+                                         : std::string("SCHED_OTHER"))
+              << " cpus=" << jts::getCpuCount() << "\n";
+
+    // Arka plan yükü
+    std::atomic<bool> stopLoad{false};
+    std::unique_ptr<jts::ThreadPool> loadPool;
+    if (opt.load > 0) {
+        loadPool = std::make_unique<jts::ThreadPool>(opt.load);
+        for (size_t i = 0; i < opt.load; ++i) {
+            loadPool->submit([&stopLoad, &opt]() { loadLoop(stopLoad, opt.loadCpus); });
+        }
+    }
+
+    std::unique_ptr<jts::Scheduler> s = opt.workers == 0
+        ? std::make_unique<jts::Scheduler>()
+        : std::make_unique<jts::Scheduler>(opt.workers);
+    s->start();
+
+    // Ölçüm görevleri: hepsi aynı önceliğe ve periyoda sahip, ilk aktivasyon
+    // 10 ms sonra (yük ve thread'ler otursun). İlk an addTaskAt'e verilir:
+    // ölçülen ve zamanlanan aktivasyon aynı andır, aradaki okuma farkı yok.
+    const auto period = std::chrono::microseconds(opt.intervalUs);
+    const auto phase = std::chrono::milliseconds(10);
+    std::vector<std::unique_ptr<Probe>> probes;
+    std::vector<uint64_t> ids;
+    for (size_t i = 0; i < opt.tasks; ++i) {
+        auto probe = std::make_unique<Probe>();
+        probe->period = period;
+        probe->linear.assign(static_cast<size_t>(opt.histUs) + 1, 0);
+        Probe* p = probe.get();
+        probes.push_back(std::move(probe));
+
+        jts::Task t;
+        t.name = "latency_probe_" + std::to_string(i);
+        t.priority = 10;
+        t.realtime = opt.fifo;
+        t.period = period;
+        if (opt.workers > 0) t.cpu_cores = opt.pin;  // Sadece sabitlenen worker'lara
+        p->base = Clock::now() + phase;
+        ids.push_back(s->addTaskAt(std::move(t), [p, &opt]() { activate(*p, opt); }, p->base));
+    }
+
+    // Tüm görevler hedef aktivasyon sayısına ulaşana kadar bekle
+    for (auto& p : probes) {
+        while (p->done.load(std::memory_order_acquire) < opt.loops) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+    for (uint64_t id : ids) s->cancelTask(id);
+    s->stop();
+    stopLoad = true;
+    if (loadPool) loadPool->shutdown();
+
+    if (pinFailed) std::cout << "UYARI: sabitleme başarısız, sabitlenmeden ölçüldü\n";
+    if (fifoFailed) std::cout << "UYARI: SCHED_FIFO ayarlanamadı (yetki?), SCHED_OTHER ile ölçüldü\n";
+
+    // Görev başına ve toplam özet
+    jts::LatencyHistogram all;
+    std::vector<uint64_t> linear(static_cast<size_t>(opt.histUs) + 1, 0);
+    uint64_t count = 0, overruns = 0;
+    int64_t minNs = INT64_MAX;
+    for (size_t i = 0; i < probes.size(); ++i) {
+        const Probe& p = *probes[i];
+        printRow("T:" + std::to_string(i), p.activations, p.minNs, p.hist, p.overruns);
+        all.merge(p.hist);
+        count += p.activations;
+        overruns += p.overruns;
+        minNs = std::min(minNs, p.minNs);
+        for (size_t b = 0; b < linear.size(); ++b) linear[b] += p.linear[b];
+    }
+    if (probes.size() > 1) printRow("ALL", count, minNs, all, overruns);
+    std::cout << "deadline misses: " << s->deadlineMisses() << "\n";
+
+    // Histogram: cyclictest gibi "us adet" satırları (boş kovalar atlanır)
+    if (opt.histUs > 0) {
+        std::cout << "# Histogram (us)\n";
+        for (size_t b = 0; b + 1 < linear.size(); ++b) {
+            if (linear[b] == 0) continue;
+            std::cout << std::setfill('0') << std::setw(6) << b << " "
+                      << std::setw(6) << linear[b] << "\n";
+        }
+        std::cout << std::setfill(' ') << "# >= " << opt.histUs << " us: " << linear.back() << "\n";
+    }
+
+    if (opt.maxUs >= 0 && all.max() / 1000 > opt.maxUs) {
+        std::cout << "BAŞARISIZ: en büyük gecikme " << all.max() / 1000 << " us > " << opt.maxUs
+                  << " us\n";
+        return 1;
+    }
+    return 0;
+}
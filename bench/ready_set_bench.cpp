@@ -0,0 +1,129 @@
+// Hazır küme seçim maliyeti: kuyrukta 1k / 10k / 100k görev varken
+// "en yüksek öncelikli görevi al ve geri koy" işleminin süresi
+//
+// scan:task  : eski yöntem, std::vector<Task> üzerinde max_element (her eleman
+//              string + vector + std::function taşır, tarama çok cache satırı gezer)
+// scan:key   : aynı doğrusal tarama, ama sıkı paketlenmiş 64-bit anahtar dizisi
+//              üzerinde (eleman başına 8 bayt, dalsız)
+// registry   : TaskRegistry::acquireNext() + complete() (4'lü heap, O(log n))
+//
+// Kullanım: bench_ready_set
+#include "task_registry.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Derleyicinin ölçülen işi atmasını önle
+volatile uint64_t sink = 0;
+
+size_t iterationsFor(size_t n) {
+    return std::max<size_t>(200, 20000000 / n);
+}
+
+double scanTasks(size_t n) {
+    std::mt19937 rng(1);
+    std::vector<jts::Task> tasks(n);
+    for (size_t i = 0; i < n; ++i) {
+        tasks[i].id = i + 1;
+        tasks[i].name = "task_" + std::to_string(i);
+        tasks[i].priority = static_cast<int>(rng() % 11);
+        tasks[i].realtime = rng() % 16 == 0;
+        tasks[i].cpu_cores = {0, 1};
+        tasks[i].work = []() {};
+    }
+    auto lower = [](const jts::Task& a, const jts::Task& b) {
+        if (a.realtime != b.realtime) return b.realtime;
+        if (a.priority != b.priority) return a.priority < b.priority;
+        return a.id > b.id;
+    };
+
+    uint64_t nextId = n + 1;
+    const size_t iters = iterationsFor(n);
+    auto t0 = Clock::now();
+    for (size_t k = 0; k < iters; ++k) {
+        auto it = std::max_element(tasks.begin(), tasks.end(), lower);
+        sink = sink + it->id;
+        it->id = nextId++;  // Yeniden kur: kuyruğun sonuna
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / iters;
+}
+
+double scanKeys(size_t n) {
+    std::mt19937 rng(1);
+    // Küçük anahtar önce: [63] realtime değil, [62:48] ters priority, [47:0] sıra
+    std::vector<uint64_t> keys(n);
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t band = (rng() % 16 == 0 ? 0u : 0x8000u) | (10 - rng() % 11);
+        keys[i] = (band << 48) | (i + 1);
+    }
+
+    uint64_t nextSeq = n + 1;
+    const size_t iters = iterationsFor(n);
+    auto t0 = Clock::now();
+    for (size_t k = 0; k < iters; ++k) {
+        // Tek geçiş, sadece 8 baytlık anahtarlar okunur (cmov ile dalsız)
+        uint64_t best = UINT64_MAX;
+        size_t pos = 0;
+        for (size_t i = 0; i < n; ++i) {
+            bool less = keys[i] < best;
+            best = less ? keys[i] : best;
+            pos = less ? i : pos;
+        }
+        sink = sink + pos;
+        keys[pos] = (best & ~((uint64_t(1) << 48) - 1)) | nextSeq++;
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / iters;
+}
+
+double registrySelect(size_t n) {
+    std::mt19937 rng(1);
+    jts::TaskRegistry reg;
+    reg.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        jts::Task t;
+        t.name = "task";
+        t.priority = static_cast<int>(rng() % 11);
+        t.realtime = rng() % 16 == 0;
+        t.period = std::chrono::milliseconds(1);  // complete() hazır heap'e geri koyar
+        reg.registerTask(std::move(t), nullptr);
+    }
+
+    const size_t iters = 200000;
+    auto t0 = Clock::now();
+    for (size_t k = 0; k < iters; ++k) {
+        jts::ScheduledTask* task = reg.acquireNext();
+        sink = sink + task->id;
+        task->release_time += task->period;  // Geçmişte kalır: hemen hazır
+        reg.complete(task);
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - t0).count() / iters;
+}
+
+} // namespace
+
+int main() {
+    jts::Logger::instance().setLevel(jts::LogLevel::Warn);
+
+    std::cout << "=== Seçim maliyeti (ns / seçim) ===\n";
+    std::cout << "  tasks      scan:task      scan:key      registry\n";
+    std::cout << std::fixed << std::setprecision(1);
+    for (size_t n : {size_t(1000), size_t(10000), size_t(100000)}) {
+        double a = scanTasks(n);
+        double b = scanKeys(n);
+        double c = registrySelect(n);
+        std::cout << std::setw(7) << n
+                  << std::setw(15) << a
+                  << std::setw(14) << b
+                  << std::setw(14) << c << "\n";
+    }
+    return 0;
+}
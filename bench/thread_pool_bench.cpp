@@ -0,0 +1,139 @@
+// ThreadPool (tek global kuyruk) ve WorkStealingPool karşılaştırması
+//
+// flat  : tüm kısa işler havuz dışından gönderilir
+// nested: her üst iş, havuz içinden küçük işler üretir (fork/join tarzı)
+// bulk  : ThreadPool::submitBulk (tek kilit + tek bildirim)
+// pfor  : ThreadPool::parallelFor (otomatik grain)
+//
+// Kullanım: bench_thread_pool [iş_sayısı]
+#include "thread_pool.hpp"
+#include "work_stealing_pool.hpp"
+#include "cpu_utils.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Kısa bir iş: ~100 ns hesap
+void tinyWork(std::atomic<size_t>& done) {
+    volatile unsigned x = 0;
+    for (unsigned i = 0; i < 64; ++i) x = x + i;
+    done.fetch_add(1, std::memory_order_relaxed);
+}
+
+void waitFor(const std::atomic<size_t>& done, size_t target) {
+    while (done.load(std::memory_order_relaxed) < target) {
+        std::this_thread::yield();
+    }
+}
+
+template <typename Pool>
+double runFlat(size_t threads, size_t jobs) {
+    Pool pool(threads);
+    std::atomic<size_t> done{0};
+
+    auto t0 = Clock::now();
+    for (size_t i = 0; i < jobs; ++i) {
+        pool.submit([&done]() { tinyWork(done); });
+    }
+    waitFor(done, jobs);
+    double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+    return jobs / sec;
+}
+
+double runBulk(size_t threads, size_t jobs) {
+    jts::ThreadPool pool(threads);
+    std::atomic<size_t> done{0};
+
+    auto t0 = Clock::now();
+    std::vector<std::function<void()>> batch;
+    batch.reserve(jobs);
+    for (size_t i = 0; i < jobs; ++i) {
+        batch.push_back([&done]() { tinyWork(done); });
+    }
+    pool.submitBulk(std::move(batch));
+    waitFor(done, jobs);
+    double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+    return jobs / sec;
+}
+
+double runParallelFor(size_t threads, size_t jobs) {
+    jts::ThreadPool pool(threads);
+    std::atomic<size_t> done{0};
+
+    auto t0 = Clock::now();
+    pool.parallelFor(0, jobs, 0, [&done](size_t) { tinyWork(done); });
+    double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+    return jobs / sec;
+}
+
+template <typename Pool>
+double runNested(size_t threads, size_t jobs) {
+    const size_t fanout = 64;
+    const size_t parents = std::max<size_t>(1, jobs / fanout);
+    const size_t total = parents * fanout;
+
+    Pool pool(threads);
+    std::atomic<size_t> done{0};
+
+    auto t0 = Clock::now();
+    for (size_t p = 0; p < parents; ++p) {
+        pool.submit([&pool, &done]() {
+            for (size_t c = 0; c < fanout; ++c) {
+                pool.submit([&done]() { tinyWork(done); });
+            }
+        });
+    }
+    waitFor(done, total);
+    double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+    return total / sec;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t jobs = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 200000;
+
+    std::vector<size_t> counts = {1, 2, 4, static_cast<size_t>(jts::getCpuCount())};
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+
+    // Scheduler/havuz logları tabloyu bozmasın
+    jts::Logger::instance().setLevel(jts::LogLevel::Warn);
+
+    struct Row { size_t threads; double flatTp, flatWs, nestTp, nestWs, bulk, pfor; };
+    std::vector<Row> rows;
+    for (size_t n : counts) {
+        rows.push_back({n,
+            runFlat<jts::ThreadPool>(n, jobs),
+            runFlat<jts::WorkStealingPool>(n, jobs),
+            runNested<jts::ThreadPool>(n, jobs),
+            runNested<jts::WorkStealingPool>(n, jobs),
+            runBulk(n, jobs),
+            runParallelFor(n, jobs)});
+    }
+
+    std::cout << "=== jobs/sec (" << jobs << " iş) ===\n";
+    std::cout << "threads   flat:ThreadPool  flat:WorkSteal  nested:ThreadPool  nested:WorkSteal"
+                 "  bulk:ThreadPool  pfor:ThreadPool\n";
+    std::cout << std::fixed << std::setprecision(0);
+    for (const auto& r : rows) {
+        std::cout << std::setw(7) << r.threads
+                  << std::setw(17) << r.flatTp
+                  << std::setw(16) << r.flatWs
+                  << std::setw(19) << r.nestTp
+                  << std::setw(18) << r.nestWs
+                  << std::setw(17) << r.bulk
+                  << std::setw(17) << r.pfor << "\n";
+    }
+    return 0;
+}
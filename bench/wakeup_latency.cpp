@@ -0,0 +1,109 @@
+// addTask() -> work() başlangıcı gecikme ölçümü
+//
+// İki mod karşılaştırılır:
+//   poll  : eski davranış (runOnce + boşta 10 ms uyku)
+//   event : Scheduler::start() (condition variable ile anında uyanma)
+//
+// Kullanım: bench_wakeup [örnek_sayısı]
+#include "scheduler.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// Worker'ın boşta beklemesi için görevler arasına rastgele boşluk koy
+void idleGap(std::mt19937& rng) {
+    std::uniform_int_distribution<int> us(500, 3000);
+    std::this_thread::sleep_for(std::chrono::microseconds(us(rng)));
+}
+
+// Tek örnek: görevi ekle, work() başlayana kadar geçen süreyi ölç
+double measureOnce(jts::Scheduler& s) {
+    std::atomic<bool> done{false};
+    Clock::time_point started;
+
+    jts::Task t;
+    t.name = "probe";
+    t.work = [&]() {
+        started = Clock::now();
+        done.store(true, std::memory_order_release);
+    };
+
+    auto t0 = Clock::now();
+    s.addTask(t);
+    while (!done.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    return std::chrono::duration<double, std::micro>(started - t0).count();
+}
+
+void report(const char* mode, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    auto pct = [&](double p) {
+        size_t i = static_cast<size_t>(p * (samples.size() - 1));
+        return samples[i];
+    };
+    std::cout << std::fixed << std::setprecision(1)
+              << std::setw(6) << mode
+              << "  min=" << std::setw(8) << samples.front()
+              << "  p50=" << std::setw(8) << pct(0.50)
+              << "  p90=" << std::setw(8) << pct(0.90)
+              << "  p99=" << std::setw(8) << pct(0.99)
+              << "  max=" << std::setw(8) << samples.back() << "  (us)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 200;
+    std::mt19937 rng(42);
+
+    // Scheduler/havuz logları tabloyu bozmasın
+    jts::Logger::instance().setLevel(jts::LogLevel::Warn);
+
+    std::vector<double> poll, event;
+
+    // --- poll: eski 10 ms uyku döngüsü ---
+    {
+        jts::Scheduler s;
+        std::atomic<bool> running{true};
+        std::thread worker([&]() {
+            while (running) {
+                if (!s.runOnce()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+        });
+        for (size_t i = 0; i < n; ++i) {
+            idleGap(rng);
+            poll.push_back(measureOnce(s));
+        }
+        running = false;
+        worker.join();
+    }
+
+    // --- event: Scheduler::start() ---
+    {
+        jts::Scheduler s;
+        s.start();
+        for (size_t i = 0; i < n; ++i) {
+            idleGap(rng);
+            event.push_back(measureOnce(s));
+        }
+        s.stop();
+    }
+
+    std::cout << "=== addTask -> start gecikmesi (" << n << " örnek) ===\n";
+    report("poll", poll);
+    report("event", event);
+    return 0;
+}
@@ -0,0 +1,148 @@
+#ifndef ASYNC_IO_HPP
+#define ASYNC_IO_HPP
+
+#include "task.hpp"
+#include "slab_pool.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jts {
+
+class Scheduler;
+class ThreadPool;
+
+// Sonuç: aktarılan bayt (>= 0; poll için revents) veya -errno
+using IoCallback = std::function<void(int64_t result)>;
+
+enum class IoBackend {
+    IoUring,    // Çekirdek halkası: tek thread yüzlerce işlemi bekler
+    ThreadPool  // io_uring yoksa (eski çekirdek, seccomp): pread/pwrite havuzda
+};
+
+struct AsyncIoOptions {
+    unsigned entries = 256;       // Gönderim halkası boyutu (tamamlama halkası 2 katı)
+    size_t fallbackThreads = 4;   // ThreadPool arka ucunda pread/pwrite/fsync thread sayısı
+    bool forceFallback = false;   // io_uring olsa bile havuzu kullan (test / karşılaştırma)
+};
+
+// Asenkron dosya okuma / yazma ve hazır olma bekleme (poll)
+// - İşlem gönderilir, çağıran thread beklemez. Bittiğinde done(result),
+//   followUp tanımıyla (ad, öncelik, tür, cpu_cores) Scheduler'a tek
+//   seferlik görev olarak eklenir (period/phase/wcet yok sayılır); sonuç
+//   işleme normal öncelik kurallarıyla yürür. done boşsa görev eklenmez.
+//   Scheduler followUp'ı kabul etmezse (ör. cpu_cores aralık dışı) done
+//   tamamlama thread'inde çalışır ve rejectedFollowUps() artar.
+// - io_uring arka ucu (liburing gerekmez, doğrudan sistem çağrıları):
+//   gönderen thread SQE'yi doldurup io_uring_enter çağırır, tek bir
+//   tamamlama thread'i CQE'leri toplar. Aynı anda en fazla tamamlama
+//   halkası kadar işlem uçuşta olur; fazlası yer açılana kadar bekler.
+// - io_uring kurulamazsa (ENOSYS/EPERM ya da READ/WRITE desteklemeyen
+//   çekirdek) aynı API fallbackThreads'lik bir ThreadPool'da pread/pwrite
+//   ile taklit edilir. poll işlemleri havuzu tutmaz: hepsi tek bir ::poll
+//   thread'inde (eventfd ile uyandırılır) birlikte beklenir.
+// - Tampon, done çalışana kadar geçerli kalmalıdır. Kısa okuma/yazma
+//   tekrar denenmez, sonuç olduğu gibi verilir.
+// - Yıkıcı bekleyen poll'ları -ECANCELED ile bitirir, diğer uçuştaki
+//   işlemlerin bitmesini bekler; Scheduler AsyncIo'dan sonra yok edilmelidir.
+//
+// Örnek:
+//   AsyncIo io(scheduler);
+//   io.write(fd, frame.data(), frame.size(), offset,
+//            [](int64_t n) { if (n < 0) logError(-n); });
+class AsyncIo {
+public:
+    explicit AsyncIo(Scheduler& scheduler, const AsyncIoOptions& options = AsyncIoOptions());
+    ~AsyncIo();
+
+    AsyncIo(const AsyncIo&) = delete;
+    AsyncIo& operator=(const AsyncIo&) = delete;
+
+    // offset: dosya konumu (bayt). followUp verilmezse "io_done" adlı,
+    // öncelik 5, TaskType::IO görev kullanılır
+    void read(int fd, void* buf, size_t len, uint64_t offset, IoCallback done);
+    void read(int fd, void* buf, size_t len, uint64_t offset, Task followUp, IoCallback done);
+    void write(int fd, const void* buf, size_t len, uint64_t offset, IoCallback done);
+    void write(int fd, const void* buf, size_t len, uint64_t offset, Task followUp,
+               IoCallback done);
+    void fsync(int fd, IoCallback done);
+    void fsync(int fd, Task followUp, IoCallback done);
+
+    // fd events'ten biri için hazır olunca (sensör / soket okunabilir)
+    // done(revents) çağrılır; tek seferlik (IORING_OP_POLL_ADD, yedek: ::poll)
+    void poll(int fd, short events, IoCallback done);
+    void poll(int fd, short events, Task followUp, IoCallback done);
+
+    // Bekleyen tüm poll'ları -ECANCELED ile bitir (devam görevleri normal
+    // eklenir; io_uring: IORING_OP_POLL_REMOVE). Hiç hazır olmayacak fd
+    // drain()'i sonsuza dek bekletmesin diye yıkıcı da çağırır
+    void cancelPolls();
+
+    // Uçuştaki tüm işlemler bitene (ve devam görevleri eklenene) kadar bekle
+    void drain();
+
+    IoBackend backend() const { return ring_ ? IoBackend::IoUring : IoBackend::ThreadPool; }
+    size_t inFlight() const;
+    uint64_t submitted() const { return submitted_.load(std::memory_order_relaxed); }
+    uint64_t completed() const { return completed_.load(std::memory_order_relaxed); }
+    // Scheduler'ın kabul etmediği devam görevleri (done tamamlama thread'inde çalışır)
+    uint64_t rejectedFollowUps() const { return rejectedFollowUps_.load(std::memory_order_relaxed); }
+
+private:
+    enum class OpCode : uint8_t { Read, Write, Fsync, Poll };
+
+    struct Op {
+        OpCode code;
+        int fd;
+        void* buf;
+        size_t len;
+        uint64_t offset;      // Poll: events
+        Task followUp;
+        IoCallback done;
+        bool cancelling = false;  // io_uring: POLL_REMOVE gönderildi (mutex_)
+    };
+
+    struct Ring;  // async_io.cpp - mmap edilmiş io_uring halkaları
+
+    static Task defaultFollowUp();
+    void submit(OpCode code, int fd, void* buf, size_t len, uint64_t offset, Task followUp,
+                IoCallback done);
+    void complete(Op* op, int64_t result);  // Devam görevini ekle, op'u serbest bırak
+    void reapLoop();                        // io_uring tamamlama thread'i
+    void pollLoop();                        // Yedek arka uç: poll thread'i
+    void wakePoller();                      // mutex_ altında
+    static int64_t runBlocking(const Op& op);
+
+    Scheduler& scheduler_;
+    std::unique_ptr<Ring> ring_;          // Boşsa ThreadPool arka ucu
+    std::unique_ptr<ThreadPool> pool_;
+    std::thread reaper_;
+    std::thread poller_;                  // Yedek arka uç: tüm poll'lar tek ::poll'da
+    int wakeFd_ = -1;                     // poller_'ı uyandıran eventfd
+
+    mutable std::mutex mutex_;            // ops_, inFlight_, polls_ ve bayraklar, gönderim halkası
+    std::condition_variable cv_;          // Yer açıldı / hepsi bitti
+    SlabPool<Op> ops_;
+    size_t inFlight_ = 0;
+    size_t maxInFlight_ = 0;
+    std::vector<Op*> polls_;              // Bekleyen poll'lar
+    bool cancelPolls_ = false;            // poller_: hepsini -ECANCELED ile bitir
+    bool closing_ = false;                // Yıkıcıda: yeni poll hemen iptal
+    bool stopPoller_ = false;
+    // submitted_ op yazıldıktan sonra release ile artar, tamamlama thread'i
+    // CQE'yi gördükten sonra acquire ile okur: op'un alanları çekirdek
+    // halkası üzerinden değil, bu çift üzerinden C++ modelinde yayımlanır
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> completed_{0};
+    std::atomic<uint64_t> rejectedFollowUps_{0};
+};
+
+} // namespace jts
+
+#endif
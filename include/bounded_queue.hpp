@@ -0,0 +1,146 @@
+#ifndef BOUNDED_QUEUE_HPP
+#define BOUNDED_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace jts {
+
+namespace detail {
+
+inline size_t roundUpPow2(size_t n) {
+    size_t cap = 2;
+    while (cap < n) cap <<= 1;
+    return cap;
+}
+
+} // namespace detail
+
+// Sınırlı kilitsiz kuyruklar
+// - Kapasite kurulumda bir kez ayrılır (2'nin kuvvetine yuvarlanır)
+// - tryPush() sadece başarılı olursa item'ı taşır; dolu/boş durumda beklemez,
+//   bekleme politikası çağırana aittir (bkz. Pipeline)
+// - T varsayılan oluşturulabilir ve taşıma ile atanabilir olmalı
+
+// Tek üretici / tek tüketici
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity)
+        : capacity_(detail::roundUpPow2(capacity))
+        , mask_(capacity_ - 1)
+        , slots_(new T[capacity_]) {}
+
+    bool tryPush(T& item) {
+        size_t t = tail_.load(std::memory_order_relaxed);
+        if (t - head_.load(std::memory_order_acquire) == capacity_) return false;
+        slots_[t & mask_] = std::move(item);
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(T& out) {
+        size_t h = head_.load(std::memory_order_relaxed);
+        if (h == tail_.load(std::memory_order_acquire)) return false;
+        out = std::move(slots_[h & mask_]);
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const {
+        size_t t = tail_.load(std::memory_order_acquire);
+        size_t h = head_.load(std::memory_order_acquire);
+        return t >= h ? t - h : 0;
+    }
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<T[]> slots_;
+    alignas(64) std::atomic<size_t> head_{0};  // Tüketici
+    alignas(64) std::atomic<size_t> tail_{0};  // Üretici
+};
+
+// Çok üretici / çok tüketici (hücre başına sıra numaralı halka)
+template <typename T>
+class MpmcQueue {
+public:
+    explicit MpmcQueue(size_t capacity)
+        : capacity_(detail::roundUpPow2(capacity))
+        , mask_(capacity_ - 1)
+        , cells_(new Cell[capacity_]) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool tryPush(T& item) {
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // Dolu
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(item);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPop(T& out) {
+        size_t pos = head_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->seq.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;  // Boş
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+        out = std::move(cell->value);
+        cell->seq.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    // Yaklaşık (eşzamanlı işlemler sırasında anlık görüntü)
+    size_t size() const {
+        size_t t = tail_.load(std::memory_order_acquire);
+        size_t h = head_.load(std::memory_order_acquire);
+        return t >= h ? t - h : 0;
+    }
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq;
+        T value;
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+};
+
+} // namespace jts
+
+#endif
@@ -0,0 +1,344 @@
+#ifndef CORO_HPP
+#define CORO_HPP
+
+// C++20 coroutine görevleri (isteğe bağlı: cmake -DJTS_COROUTINES=ON)
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "coro.hpp C++20 coroutine desteği ister (cmake -DJTS_COROUTINES=ON)"
+#endif
+
+#include "async_io.hpp"
+#include "future.hpp"
+#include "scheduler.hpp"
+#include "thread_pool.hpp"
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <poll.h>
+#include <stdexcept>
+#include <utility>
+
+namespace jts {
+
+// Coroutine görevleri
+// - task<T> tembeldir: co_await edilene ya da spawn() ile bir yürütücüye
+//   verilene kadar çalışmaz. Bitince bekleyen coroutine simetrik aktarımla
+//   aynı thread'de devam eder (yığın büyümez, kuyruk dolaşması yok).
+// - Askıya alınan coroutine worker'ı bloklamaz: worker görevi bitmiş sayar
+//   ve sıradaki göreve geçer. Devam, Scheduler'a (Task tanımıyla: ad,
+//   öncelik, tür, cpu_cores -> hangi çekirdekte) ya da ThreadPool'a
+//   (öncelikle) tek seferlik iş olarak eklenir.
+// - Beklenebilenler: sleepFor/sleepUntil (zamanlama tekerleği),
+//   resumeOn (yürütücü / çekirdek değiştir), başka bir task<T> (tamamlanma),
+//   asyncRead/asyncWrite/asyncFsync/asyncPoll (AsyncIo, sonuç veya -errno).
+// - İstisnalar co_await'te, spawn() ile başlatılanlarda Future::get()'te
+//   yeniden fırlatılır.
+// - Devam her zaman tek seferlik görevdir: tanımdaki period/phase/wcet
+//   temizlenir (periyodik yeniden kurma bitmiş çerçeveyi sürdürürdü).
+//   Scheduler görevi kabul etmezse (ör. cpu_cores aralık dışı) co_await
+//   std::invalid_argument fırlatır, spawn() ise Future'a yazar. async*
+//   followUp tanımı da aynı kurala uyar (hata IO gönderilmeden verilir).
+// - Yürütücüler ve AsyncIo, askıdaki coroutine'lerden uzun yaşamalıdır.
+//
+// Örnek:
+//   jts::task<int> readFrame(jts::AsyncIo& io, int fd, char* buf) {
+//       co_await jts::asyncPoll(io, fd, POLLIN);
+//       int64_t n = co_await jts::asyncRead(io, fd, buf, 4096, 0);
+//       co_return static_cast<int>(n);
+//   }
+//   jts::task<> sensorLoop(jts::Scheduler& s, jts::AsyncIo& io, int fd) {
+//       char buf[4096];
+//       for (;;) {
+//           int n = co_await readFrame(io, fd, buf);
+//           process(buf, n);
+//           co_await jts::sleepFor(s, std::chrono::milliseconds(10));
+//       }
+//   }
+//   jts::spawn(s, sensorLoop(s, io, fd));
+
+template <typename T = void>
+class task;
+
+// Coroutine'in devam edeceği yer: Scheduler (görev tanımıyla) ya da ThreadPool
+class Executor {
+public:
+    Executor(Scheduler& scheduler, Task desc = defaultTask())
+        : scheduler_(&scheduler), desc_(oneShot(std::move(desc))) {}
+    Executor(ThreadPool& pool, int priority = ThreadPool::kDefaultPriority)
+        : pool_(&pool), priority_(priority) {}
+
+    // Sonradan çağrı this'e dokunmaz: devam başka thread'de hemen başlayıp
+    // bu nesneyi (coroutine çerçevesindeyse) yok edebilir.
+    // Scheduler görevi kabul etmezse false; h askıda kalır, sürdürülmez
+    bool post(std::coroutine_handle<> h) const {
+        if (scheduler_) {
+            return scheduler_->addTask(desc_, [h]() { h.resume(); }) != 0;
+        }
+        pool_->submit(priority_, [h]() { h.resume(); });
+        return true;
+    }
+
+    // "coro", öncelik 5, TaskType::CPU
+    static Task defaultTask() {
+        Task t;
+        t.name = "coro";
+        return t;
+    }
+
+    // Devam tanımı: periyodik değil, faz ve bütçe yok
+    static Task oneShot(const Task& desc) { return desc.oneShot(); }
+
+private:
+    Scheduler* scheduler_ = nullptr;
+    ThreadPool* pool_ = nullptr;
+    Task desc_;
+    int priority_ = ThreadPool::kDefaultPriority;
+};
+
+namespace detail {
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation;
+    std::exception_ptr error;
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept {
+            std::coroutine_handle<> next = h.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() noexcept { error = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value;
+
+    task<T> get_return_object() noexcept;
+    template <typename U>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+    T result() {
+        if (error) std::rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    task<void> get_return_object() noexcept;
+    void return_void() const noexcept {}
+    void result() const {
+        if (error) std::rethrow_exception(error);
+    }
+};
+
+// spawn() kökü: kendini yok eder, sonucu Promise'e yazar
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() noexcept {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+    std::coroutine_handle<promise_type> handle;
+};
+
+template <typename T>
+Detached runDetached(task<T> t, Promise<T> promise) {
+    try {
+        if constexpr (std::is_void<T>::value) {
+            co_await std::move(t);
+            promise.setValue();
+        } else {
+            promise.setValue(co_await std::move(t));
+        }
+    } catch (...) {
+        promise.setException(std::current_exception());
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+class task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    task(task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    task& operator=(task&& other) noexcept {
+        if (this != &other) {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+    task(const task&) = delete;
+    task& operator=(const task&) = delete;
+    ~task() {
+        if (handle_) handle_.destroy();
+    }
+
+    bool done() const { return !handle_ || handle_.done(); }
+
+    // co_await task: çocuğu başlat, bitince bu coroutine devam etsin
+    auto operator co_await() && noexcept {
+        struct Awaiter {
+            std::coroutine_handle<promise_type> h;
+            bool await_ready() const noexcept { return h.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+                h.promise().continuation = awaiting;
+                return h;
+            }
+            T await_resume() { return h.promise().result(); }
+        };
+        return Awaiter{handle_};
+    }
+
+private:
+    friend struct detail::TaskPromise<T>;
+    explicit task(std::coroutine_handle<promise_type> h) : handle_(h) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+template <typename T>
+task<T> detail::TaskPromise<T>::get_return_object() noexcept {
+    return task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline task<void> detail::TaskPromise<void>::get_return_object() noexcept {
+    return task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+// Coroutine'i yürütücüde başlat; sonuç (veya istisna) Future'dan alınır.
+// Future beklenmese de coroutine sonuna kadar çalışır.
+template <typename T>
+Future<T> spawn(const Executor& executor, task<T> t) {
+    Promise<T> promise;
+    Future<T> future = promise.getFuture();
+    detail::Detached root = detail::runDetached(std::move(t), promise);
+    if (!executor.post(root.handle)) {
+        root.handle.destroy();  // Hiç başlamadı: task da onunla yok edilir
+        promise.setException(std::make_exception_ptr(
+            std::invalid_argument("spawn: yürütücü görevi kabul etmedi")));
+    }
+    return future;
+}
+
+// Devamı verilen yürütücüye taşı (ör. cpu_cores ile başka çekirdeğe)
+inline auto resumeOn(Executor executor) {
+    struct Awaiter {
+        Executor executor;
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> h) const {
+            if (!executor.post(h)) {
+                throw std::invalid_argument("resumeOn: yürütücü görevi kabul etmedi");
+            }
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{std::move(executor)};
+}
+
+// Zamanlama tekerleğinde bekle; devam desc ile (addTaskAt) çalışır
+inline auto sleepUntil(Scheduler& scheduler, std::chrono::steady_clock::time_point when,
+                       Task desc = Executor::defaultTask()) {
+    struct Awaiter {
+        Scheduler& scheduler;
+        std::chrono::steady_clock::time_point when;
+        Task desc;
+        bool await_ready() const noexcept { return when <= std::chrono::steady_clock::now(); }
+        void await_suspend(std::coroutine_handle<> h) const {
+            if (scheduler.addTaskAt(desc, [h]() { h.resume(); }, when) == 0) {
+                throw std::invalid_argument("sleepUntil: görev kabul edilmedi");
+            }
+        }
+        void await_resume() const noexcept {}
+    };
+    return Awaiter{scheduler, when, Executor::oneShot(std::move(desc))};
+}
+
+inline auto sleepFor(Scheduler& scheduler, std::chrono::steady_clock::duration delay,
+                     Task desc = Executor::defaultTask()) {
+    return sleepUntil(scheduler, std::chrono::steady_clock::now() + delay, std::move(desc));
+}
+
+namespace detail {
+
+// AsyncIo işlemi: devam görevi (followUp ya da "io_done") coroutine'i sürdürür
+template <typename Submit>
+struct IoAwaiter {
+    Submit submit;
+    int64_t result = 0;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> h) {
+        submit([this, h](int64_t n) {
+            result = n;
+            h.resume();
+        });
+    }
+    int64_t await_resume() const noexcept { return result; }
+};
+
+template <typename Submit>
+IoAwaiter<Submit> ioAwaiter(Submit submit) {
+    return IoAwaiter<Submit>{std::move(submit)};
+}
+
+// AsyncIo devam tanımı: tek seferlik; Scheduler'ın reddedeceği tanım IO
+// gönderilmeden co_await'te hata olur (devam kaybolup coroutine askıda kalmasın)
+inline Task ioFollowUp(const Task& followUp) {
+    if (!CpuMask::representable(followUp.cpu_cores)) {
+        throw std::invalid_argument("async IO: devam görevi kabul edilmez (cpu_cores)");
+    }
+    return Executor::oneShot(followUp);
+}
+
+} // namespace detail
+
+// Sonuç: aktarılan bayt ya da -errno (AsyncIo ile aynı)
+inline auto asyncRead(AsyncIo& io, int fd, void* buf, size_t len, uint64_t offset,
+                      std::optional<Task> followUp = std::nullopt) {
+    return detail::ioAwaiter([&io, fd, buf, len, offset, followUp](IoCallback done) {
+        if (followUp) io.read(fd, buf, len, offset, detail::ioFollowUp(*followUp), std::move(done));
+        else io.read(fd, buf, len, offset, std::move(done));
+    });
+}
+
+inline auto asyncWrite(AsyncIo& io, int fd, const void* buf, size_t len, uint64_t offset,
+                       std::optional<Task> followUp = std::nullopt) {
+    return detail::ioAwaiter([&io, fd, buf, len, offset, followUp](IoCallback done) {
+        if (followUp) io.write(fd, buf, len, offset, detail::ioFollowUp(*followUp), std::move(done));
+        else io.write(fd, buf, len, offset, std::move(done));
+    });
+}
+
+inline auto asyncFsync(AsyncIo& io, int fd, std::optional<Task> followUp = std::nullopt) {
+    return detail::ioAwaiter([&io, fd, followUp](IoCallback done) {
+        if (followUp) io.fsync(fd, detail::ioFollowUp(*followUp), std::move(done));
+        else io.fsync(fd, std::move(done));
+    });
+}
+
+// fd hazır olana kadar bekle; sonuç revents ya da -errno
+inline auto asyncPoll(AsyncIo& io, int fd, short events = POLLIN,
+                      std::optional<Task> followUp = std::nullopt) {
+    return detail::ioAwaiter([&io, fd, events, followUp](IoCallback done) {
+        if (followUp) io.poll(fd, events, detail::ioFollowUp(*followUp), std::move(done));
+        else io.poll(fd, events, std::move(done));
+    });
+}
+
+} // namespace jts
+
+#endif
@@ -6,7 +6,7 @@
 
 namespace jts {
 
-// CPU çekirdek sayısını al
+// Çevrimiçi CPU sayısını al (Topology::system().size())
 int getCpuCount();
 
 // Thread'i belirli çekirdeklere bağla
@@ -0,0 +1,172 @@
+#ifndef FUTURE_HPP
+#define FUTURE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace jts {
+
+namespace detail {
+
+// Linux futex sarmalayıcıları (future.cpp)
+// timeoutNs < 0: süresiz bekle
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected, int64_t timeoutNs);
+// Mutlak CLOCK_MONOTONIC anına (steady_clock ns) kadar bekle; deadlineNs < 0: süresiz
+void futexWaitUntil(std::atomic<uint32_t>& word, uint32_t expected, int64_t deadlineNs);
+void futexWakeAll(std::atomic<uint32_t>& word);
+
+// Tamamlanma bayrağı: 0 = bekliyor, 1 = bekliyor + uyuyan var, 2 = hazır
+// Uyuyan yoksa tamamlayan taraf sistem çağrısı yapmaz
+class Completion {
+public:
+    bool ready() const { return state_.load(std::memory_order_acquire) == kReady; }
+
+    void set() {
+        if (state_.exchange(kReady, std::memory_order_acq_rel) == kWaiting) {
+            futexWakeAll(state_);
+        }
+    }
+
+    // timeoutNs < 0: süresiz. Hazırsa true
+    bool wait(int64_t timeoutNs = -1) const {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::nanoseconds(timeoutNs);
+        uint32_t s = state_.load(std::memory_order_acquire);
+        while (s != kReady) {
+            if (s == kPending &&
+                !state_.compare_exchange_weak(s, kWaiting, std::memory_order_acq_rel)) {
+                continue;  // s güncellendi, tekrar bak
+            }
+            int64_t left = -1;
+            if (timeoutNs >= 0) {
+                left = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    deadline - std::chrono::steady_clock::now()).count();
+                if (left <= 0) return false;
+            }
+            futexWait(state_, kWaiting, left);
+            s = state_.load(std::memory_order_acquire);
+        }
+        return true;
+    }
+
+private:
+    static constexpr uint32_t kPending = 0;
+    static constexpr uint32_t kWaiting = 1;
+    static constexpr uint32_t kReady = 2;
+    mutable std::atomic<uint32_t> state_{kPending};
+};
+
+template <typename T>
+struct SharedState {
+    Completion done;
+    std::optional<T> value;
+    std::exception_ptr error;
+};
+
+template <>
+struct SharedState<void> {
+    Completion done;
+    std::exception_ptr error;
+};
+
+} // namespace detail
+
+// Hafif future: sonuç değeri veya istisna taşır
+// - Bekleme futex üzerindedir (polling yok); hazırsa wait() sistem çağrısı yapmaz
+// - get() bir kez çağrılır (değer taşınarak çıkar), istisna varsa yeniden fırlatır
+// - Kopyalanabilir; kopyalar aynı sonucu paylaşır (get() yine tek sefer)
+template <typename T>
+class Future {
+public:
+    Future() = default;
+
+    bool valid() const { return state_ != nullptr; }
+    bool ready() const { return state_ && state_->done.ready(); }
+
+    void wait() const { state_->done.wait(); }
+
+    template <typename Rep, typename Period>
+    bool waitFor(std::chrono::duration<Rep, Period> timeout) const {
+        return state_->done.wait(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(timeout).count());
+    }
+
+    T get() {
+        wait();
+        if (state_->error) std::rethrow_exception(state_->error);
+        if constexpr (!std::is_void<T>::value) {
+            return std::move(*state_->value);
+        }
+    }
+
+private:
+    template <typename> friend class Promise;
+    explicit Future(std::shared_ptr<detail::SharedState<T>> state) : state_(std::move(state)) {}
+
+    std::shared_ptr<detail::SharedState<T>> state_;
+};
+
+// Future'ın yazan tarafı; sonuç bir kez kurulur (sonrakiler yok sayılır)
+template <typename T>
+class Promise {
+public:
+    Promise() : state_(std::make_shared<detail::SharedState<T>>()) {}
+
+    Future<T> getFuture() const { return Future<T>(state_); }
+
+    template <typename U = T, typename = std::enable_if_t<!std::is_void<U>::value>>
+    void setValue(U value) {
+        if (state_->done.ready()) return;
+        state_->value.emplace(std::move(value));
+        state_->done.set();
+    }
+
+    template <typename U = T, typename = std::enable_if_t<std::is_void<U>::value>>
+    void setValue() {
+        if (state_->done.ready()) return;
+        state_->done.set();
+    }
+
+    void setException(std::exception_ptr error) {
+        if (state_->done.ready()) return;
+        state_->error = std::move(error);
+        state_->done.set();
+    }
+
+    // fn'i çalıştır, dönüşünü veya fırlattığını sonuca yaz
+    template <typename F>
+    void fulfill(F& fn) {
+        try {
+            if constexpr (std::is_void<T>::value) {
+                fn();
+                setValue();
+            } else {
+                setValue(fn());
+            }
+        } catch (...) {
+            setException(std::current_exception());
+        }
+    }
+
+private:
+    std::shared_ptr<detail::SharedState<T>> state_;
+};
+
+// Toplu bekleme: hepsi hazır olana kadar
+template <typename T>
+void waitAll(const std::vector<Future<T>>& futures) {
+    for (const auto& f : futures) {
+        if (f.valid()) f.wait();
+    }
+}
+
+} // namespace jts
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef HISTOGRAM_HPP
+#define HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace jts {
+
+// HDR tarzı log-lineer gecikme histogramı (nanosaniye)
+// - Her 2'nin kuvveti aralığı 32 eşit alt kovaya bölünür (~%3 hassasiyet)
+// - 0 .. ~137 s aralığı sabit boyutlu bir dizide, allocation yok
+// - record() tek yazıcı içindir (sahip thread), okuma her thread'den yapılabilir
+// - Histogramlar toplanabilir (merge) ve çıkarılabilir (subtract); böylece
+//   thread'ler birleştirilir, zaman penceresi iki anlık görüntünün farkıdır
+class LatencyHistogram {
+public:
+    static constexpr int kSubBits = 5;
+    static constexpr int kSubCount = 1 << kSubBits;   // 32
+    static constexpr int kMaxExp = 36;                // 2^37 ns üstü son kovaya
+    static constexpr size_t kBuckets = kSubCount + (kMaxExp - kSubBits + 1) * kSubCount;
+
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram& other);
+    LatencyHistogram& operator=(const LatencyHistogram& other);
+
+    void record(int64_t valueNs);
+
+    void merge(const LatencyHistogram& other);
+    void subtract(const LatencyHistogram& older);
+    void reset();  // Sadece sahip thread ya da yazıcı yokken
+
+    uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+    double mean() const;
+    int64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    // p: 0..100 (örn. 99.9). Kovanın üst sınırı döner, max ile sınırlanır.
+    int64_t percentile(double p) const;
+
+    static size_t bucketIndex(int64_t valueNs);
+    static int64_t bucketUpper(size_t index);
+
+private:
+    std::atomic<uint64_t> counts_[kBuckets];
+    std::atomic<uint64_t> count_{0};
+    std::atomic<int64_t> sum_{0};
+    std::atomic<int64_t> max_{0};
+
+    // Tek yazıcı: atomik RMW yerine load + store yeterli
+    static void bump(std::atomic<uint64_t>& a, uint64_t d) {
+        a.store(a.load(std::memory_order_relaxed) + d, std::memory_order_relaxed);
+    }
+};
+
+} // namespace jts
+
+#endif
@@ -0,0 +1,132 @@
+#ifndef INLINE_FUNCTION_HPP
+#define INLINE_FUNCTION_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace jts {
+
+template <typename Signature, size_t Capacity = 64>
+class InlineFunction;
+
+// Küçük tampon optimizasyonlu, sadece taşınabilir çağrılabilir sarmalayıcı
+// - Yakalamaları Capacity bayta sığan (ve noexcept taşınabilen) çağrılabilirler
+//   nesnenin içinde saklanır: oluşturma, taşıma ve yok etmede allocation yok
+// - Sığmayanlar heap'e düşer (doğru çalışır, sadece allocation yapar)
+// - std::function'dan farkı: kopyalanamaz, bu yüzden move-only lambda'ları da
+//   kabul eder ve kopyalama sırasında gizli allocation olmaz
+template <typename R, typename... Args, size_t Capacity>
+class InlineFunction<R(Args...), Capacity> {
+public:
+    InlineFunction() noexcept = default;
+    InlineFunction(std::nullptr_t) noexcept {}
+
+    template <typename F,
+              typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same<Fn, InlineFunction>::value &&
+                                          !std::is_same<Fn, std::nullptr_t>::value>>
+    InlineFunction(F&& f) {
+        if constexpr (fitsInline<Fn>()) {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(f));
+            ops_ = &inlineOps<Fn>;
+        } else {
+            ::new (static_cast<void*>(storage_)) Fn*(new Fn(std::forward<F>(f)));
+            ops_ = &heapOps<Fn>;
+        }
+    }
+
+    InlineFunction(InlineFunction&& other) noexcept {
+        moveFrom(other);
+    }
+
+    InlineFunction& operator=(InlineFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    InlineFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    InlineFunction(const InlineFunction&) = delete;
+    InlineFunction& operator=(const InlineFunction&) = delete;
+
+    ~InlineFunction() { reset(); }
+
+    R operator()(Args... args) {
+        return ops_->invoke(storage_, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const noexcept { return ops_ != nullptr; }
+
+    // Çağrılabilir nesne içeride mi saklanıyor (test ve teşhis için)
+    bool isInline() const noexcept { return ops_ && ops_->inlined; }
+
+    void reset() noexcept {
+        if (ops_) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+private:
+    struct Ops {
+        R (*invoke)(void*, Args&&...);
+        void (*move)(void* dst, void* src) noexcept;  // src'yi dst'ye taşı, src'yi yok et
+        void (*destroy)(void*) noexcept;
+        bool inlined;
+    };
+
+    template <typename Fn>
+    static constexpr bool fitsInline() {
+        return sizeof(Fn) <= Capacity &&
+               alignof(Fn) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible<Fn>::value;
+    }
+
+    template <typename Fn>
+    static constexpr Ops inlineOps = {
+        [](void* s, Args&&... args) -> R {
+            return (*static_cast<Fn*>(s))(std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Fn(std::move(*static_cast<Fn*>(src)));
+            static_cast<Fn*>(src)->~Fn();
+        },
+        [](void* s) noexcept { static_cast<Fn*>(s)->~Fn(); },
+        true
+    };
+
+    template <typename Fn>
+    static constexpr Ops heapOps = {
+        [](void* s, Args&&... args) -> R {
+            return (**static_cast<Fn**>(s))(std::forward<Args>(args)...);
+        },
+        [](void* dst, void* src) noexcept {
+            ::new (dst) Fn*(*static_cast<Fn**>(src));  // Sadece işaretçi taşınır
+        },
+        [](void* s) noexcept { delete *static_cast<Fn**>(s); },
+        false
+    };
+
+    void moveFrom(InlineFunction& other) noexcept {
+        if (other.ops_) {
+            other.ops_->move(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[Capacity];
+    const Ops* ops_ = nullptr;
+};
+
+} // namespace jts
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef LOGGER_HPP
+#define LOGGER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace jts {
+
+enum class LogLevel : uint8_t {
+    Trace = 0,
+    Debug = 1,
+    Info  = 2,
+    Warn  = 3,
+    Error = 4,
+    Off   = 5
+};
+
+const char* logLevelToString(LogLevel level);
+
+// Log çıktısı hedefi; kendi hedefinizi (dosya, syslog, ağ) bundan türetin.
+// write() sadece arka plan log thread'inden çağrılır.
+class LogSink {
+public:
+    virtual ~LogSink() = default;
+    virtual void write(LogLevel level, const char* message, size_t length) = 0;
+    virtual void flush() {}
+};
+
+// Varsayılan hedef: Warn ve üstü std::cerr, diğerleri std::cout
+class ConsoleSink : public LogSink {
+public:
+    void write(LogLevel level, const char* message, size_t length) override;
+    void flush() override;
+};
+
+// Asenkron logger
+// - log() mesajı sabit boyutlu bir kayda biçimlendirir ve kilitsiz, sınırlı
+//   bir kuyruğa koyar; allocation ve terminal I/O yoktur, asla beklemez
+// - Kuyruk doluysa mesaj atılır ve sayılır (dropped)
+// - Düşük öncelikli (nice 19) bir thread kuyruğu periyodik olarak sink'e yazar
+// - JTS_LOG_MIN_LEVEL altındaki JTS_LOG_* çağrıları derleme zamanında kaybolur
+class Logger {
+public:
+    static Logger& instance();
+
+    void setLevel(LogLevel level) { level_.store(level, std::memory_order_relaxed); }
+    LogLevel level() const { return level_.load(std::memory_order_relaxed); }
+    bool enabled(LogLevel level) const { return level >= this->level(); }
+
+    void setSink(std::shared_ptr<LogSink> sink);
+
+    // printf biçimli; mesaj kMaxMessage karakterde kesilir
+    void log(LogLevel level, const char* format, ...)
+        __attribute__((format(printf, 3, 4)));
+
+    // Kuyruktaki her şeyi şimdi yaz (test ve çıkış için)
+    void flush();
+
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    ~Logger();
+
+private:
+    Logger();
+
+    static constexpr size_t kCapacity = 1024;   // 2'nin kuvveti
+    static constexpr size_t kMaxMessage = 238;
+
+    struct Cell {
+        std::atomic<size_t> seq;
+        LogLevel level;
+        uint16_t length;
+        char text[kMaxMessage + 1];
+    };
+
+    void drainLoop();
+    void drain();  // drainMutex_ altında çağrılır
+
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<size_t> tail_{0};  // Üreticiler
+    alignas(64) size_t head_ = 0;              // Tek tüketici (drainMutex_)
+
+    std::atomic<LogLevel> level_{LogLevel::Info};
+    std::atomic<uint64_t> dropped_{0};
+
+    std::mutex drainMutex_;
+    std::shared_ptr<LogSink> sink_;
+
+    std::thread thread_;
+    std::mutex stopMutex_;
+    std::condition_variable stopCv_;
+    bool stop_ = false;
+};
+
+} // namespace jts
+
+// Derleme zamanı alt sınırı: 0=Trace 1=Debug 2=Info 3=Warn 4=Error 5=Off
+#ifndef JTS_LOG_MIN_LEVEL
+#define JTS_LOG_MIN_LEVEL 1
+#endif
+
+#define JTS_LOG(level, ...)                                                    \
+    do {                                                                       \
+        if (static_cast<int>(level) >= JTS_LOG_MIN_LEVEL &&                    \
+            ::jts::Logger::instance().enabled(level)) {                        \
+            ::jts::Logger::instance().log(level, __VA_ARGS__);                 \
+        }                                                                      \
+    } while (0)
+
+#define JTS_LOG_TRACE(...) JTS_LOG(::jts::LogLevel::Trace, __VA_ARGS__)
+#define JTS_LOG_DEBUG(...) JTS_LOG(::jts::LogLevel::Debug, __VA_ARGS__)
+#define JTS_LOG_INFO(...)  JTS_LOG(::jts::LogLevel::Info, __VA_ARGS__)
+#define JTS_LOG_WARN(...)  JTS_LOG(::jts::LogLevel::Warn, __VA_ARGS__)
+#define JTS_LOG_ERROR(...) JTS_LOG(::jts::LogLevel::Error, __VA_ARGS__)
+
+#endif
@@ -5,7 +5,14 @@
 #include <chrono>
 #include <string>
 #include <vector>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <unordered_map>
+#include "histogram.hpp"
 
 namespace jts {
 
@@ -18,18 +25,172 @@ struct TaskMetrics {
     bool success;
 };
 
+// Bir görev adı için gecikme özeti (süreler ms)
+struct LatencyStats {
+    std::string task_name;
+    uint64_t count;
+    double mean_ms;
+    double p50_ms;
+    double p90_ms;
+    double p99_ms;
+    double p999_ms;
+    double max_ms;
+};
+
+// Anlık değer (ör. kuyruk derinliği) özeti
+struct GaugeStats {
+    std::string name;
+    int64_t last;
+    int64_t max;
+    double mean;
+    uint64_t samples;
+};
+
+// recordStart() dönüşü: recordEnd() bunu alır, arama yapmaz (O(1))
+struct MetricsToken {
+    uint64_t task_id;
+    int64_t start_ns;
+    uint32_t name_id;
+};
+
+// Kayıt yolu kilitsizdir:
+// - Her thread kendi tek üreticili halka tamponuna yazar
+// - Görev adları bir kez sayıya çevrilir (intern), kayıtlarda sadece id var
+// - Arka plan toplayıcı thread halkaları periyodik olarak boşaltır
+// - Geçmiş historyLimit kayıtla sınırlıdır; bellek uzun çalışmada büyümez
+// - Thread çıkınca halkası emekli olur: toplayıcı kalan kayıtları boşaltıp
+//   halkayı bırakır, histogramları ad başına tek birikimliye katılır
+//   (esnek havuzda thread'ler gelip gitse de bellek sınırlı kalır)
+// - Her thread her görev adı için kendi histogramını kayıt anında günceller;
+//   sorguda thread'ler birleştirilir. Toplayıcı her snapshotInterval'da
+//   birleşik histogramın anlık görüntüsünü saklar, pencere sorgusu
+//   "şimdi - pencere başındaki görüntü" farkıdır.
 class MetricsCollector {
 public:
-    void recordStart(uint64_t id, const std::string& name);
+    explicit MetricsCollector(size_t historyLimit = 10000,
+                              std::chrono::milliseconds drainInterval = std::chrono::milliseconds(10),
+                              std::chrono::milliseconds snapshotInterval = std::chrono::milliseconds(1000));
+    ~MetricsCollector();
+
+    MetricsCollector(const MetricsCollector&) = delete;
+    MetricsCollector& operator=(const MetricsCollector&) = delete;
+
+    // Görev adını sayıya çevir (aynı ad hep aynı id)
+    uint32_t internName(const std::string& name);
+
+    MetricsToken recordStart(uint64_t id, const std::string& name);
+    MetricsToken recordStart(uint64_t id, uint32_t nameId);
+    void recordEnd(const MetricsToken& token, bool success = true);
+
+    // Eski API: aynı thread'de recordStart(id, ad) ile açılmış en son kaydı
+    // id ile kapatır (son 64 açılış içinde aranır)
     void recordEnd(uint64_t id, bool success = true);
-    
+
     std::vector<TaskMetrics> getAll() const;
-    void printSummary() const;
+
+    // Görev adı başına p50/p90/p99/p99.9/max, ortalama ve adet
+    // window = 0: tüm zamanlar, aksi halde son window süresi
+    // (en fazla kMaxSnapshots * snapshotInterval geriye gidilebilir)
+    std::vector<LatencyStats> latencyStats(
+        std::chrono::milliseconds window = std::chrono::milliseconds(0)) const;
+
+    // Gösterge (gauge): son/en büyük/ortalama değer tutulan sayaçlar.
+    // registerGauge() kilitlidir (bir kez), setGauge() kilitsizdir.
+    // En fazla kMaxGauges gösterge; fazlası kInvalidGauge döner ve yok sayılır
+    static constexpr uint32_t kInvalidGauge = UINT32_MAX;
+    uint32_t registerGauge(const std::string& name);
+    void setGauge(uint32_t gaugeId, int64_t value);
+    std::vector<GaugeStats> gaugeStats() const;
+
+    void printSummary(std::chrono::milliseconds window = std::chrono::milliseconds(0)) const;
     void clear();
 
+    // Halka tamponu dolu olduğu için düşürülen kayıt sayısı
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // Canlı thread halkası sayısı (çıkmış thread'lerinki toplayıcıda silinir)
+    size_t threadRings() const;
+
 private:
-    std::vector<TaskMetrics> metrics_;
-    mutable std::mutex mutex_;
+    struct Record {
+        uint64_t task_id;
+        int64_t start_ns;
+        int64_t end_ns;
+        uint32_t name_id;
+        bool success;
+    };
+
+    struct ThreadRing;  // metrics.cpp içinde tanımlı
+
+    // Birleşik histogramların zaman damgalı anlık görüntüsü (name id sırasıyla)
+    struct Snapshot {
+        int64_t time_ns;
+        std::vector<LatencyHistogram> perName;
+    };
+
+    static constexpr size_t kMaxSnapshots = 60;
+    static constexpr size_t kMaxGauges = 256;
+
+    struct Gauge {
+        std::string name;
+        std::atomic<int64_t> last{0};
+        std::atomic<int64_t> max{0};
+        std::atomic<int64_t> sum{0};
+        std::atomic<uint64_t> samples{0};
+    };
+
+    ThreadRing& localRing();
+    LatencyHistogram& localHistogram(ThreadRing& ring, uint32_t nameId);
+    void drain() const;          // Tüm halkaları geçmişe aktar
+    void reclaimRetired();       // Çıkmış thread'lerin halkalarını boşalt ve bırak
+    std::vector<LatencyHistogram> mergedHistograms() const;
+    void takeSnapshot();
+    void aggregatorLoop();
+
+    const uint64_t instanceId_;  // thread_local önbellekte anahtar
+    const size_t historyLimit_;
+    const std::chrono::milliseconds drainInterval_;
+    const std::chrono::milliseconds snapshotInterval_;
+
+    // Halkalar (thread başına bir tane; thread'in thread_local önbelleği ile
+    // paylaşılır, hangisi önce biterse diğeri sahip kalır)
+    mutable std::mutex ringsMutex_;
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+
+    // İsim tablosu
+    mutable std::mutex namesMutex_;
+    std::unordered_map<std::string, uint32_t> nameIds_;
+    std::vector<std::string> names_;
+
+    // Toplanmış geçmiş (drainMutex_ altında, tek tüketici)
+    mutable std::mutex drainMutex_;
+    mutable std::deque<Record> history_;
+
+    // Thread başına histogramlar (yazma sahip thread'de, okuma burada).
+    // owner boşsa çıkmış thread'lerin ad başına birikimlisidir
+    struct HistogramEntry {
+        uint32_t name_id;
+        const ThreadRing* owner;
+        std::unique_ptr<LatencyHistogram> hist;
+    };
+    mutable std::mutex histMutex_;
+    std::vector<HistogramEntry> histograms_;
+    std::vector<LatencyHistogram> clearBase_;  // clear() anındaki toplamlar (name id sırasıyla)
+
+    mutable std::mutex snapMutex_;
+    std::deque<Snapshot> snapshots_;
+
+    // Göstergeler: sabit dizi, kayıtlı olanlar [0, gaugeCount_) (adresler kararlı)
+    std::unique_ptr<Gauge[]> gauges_;
+    std::atomic<uint32_t> gaugeCount_{0};
+    std::mutex gaugeMutex_;
+
+    std::atomic<uint64_t> dropped_{0};
+
+    std::thread aggregator_;
+    std::mutex stopMutex_;
+    std::condition_variable stopCv_;
+    bool stop_ = false;
 };
 
 } // namespace jts
@@ -0,0 +1,285 @@
+#ifndef PIPELINE_HPP
+#define PIPELINE_HPP
+
+#include "bounded_queue.hpp"
+#include "cpu_utils.hpp"
+#include "logger.hpp"
+#include "metrics.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace jts {
+
+// Kuyruk dolduğunda ne yapılacağı
+enum class OverflowPolicy {
+    Block,       // Üretici yer açılana kadar bekler (kayıpsız, geri basınç)
+    DropOldest,  // En eski öğe atılır, yeni öğe girer (en taze kare önemli)
+    DropNewest   // Yeni öğe atılır (push false döner)
+};
+
+struct StageOptions {
+    int core = -1;          // Sabitlenecek çekirdek (-1: sabitleme yok)
+    size_t workers = 1;     // Bu aşamayı işleyen thread sayısı
+    size_t capacity = 16;   // Giriş kuyruğu kapasitesi (2'nin kuvvetine yuvarlanır)
+    OverflowPolicy overflow = OverflowPolicy::Block;
+};
+
+struct StageStats {
+    std::string name;
+    uint64_t processed;   // İşlenen öğe
+    uint64_t dropped;     // Kuyruk dolu olduğu için atılan
+    uint64_t filtered;    // Aşama fonksiyonunun false döndürdüğü
+    size_t depth;         // Anlık kuyruk derinliği
+    size_t capacity;
+    double throughput;    // Öğe/saniye (start()'tan beri)
+};
+
+// Kare (frame) akışı için sabit aşamalı pipeline
+// - Her aşamanın kendi thread'leri (isteğe bağlı çekirdeğe sabitli) ve sınırlı
+//   kilitsiz giriş kuyruğu vardır; birden fazla kare aynı anda farklı
+//   aşamalarda işlenir. Kare başına TaskRegistry kaydı/allocation yok.
+// - Tek üretici ve tek worker'lı aşamalar SPSC, diğerleri MPMC kuyruk kullanır
+//   (DropOldest tüketici tarafından da pop yaptığı için her zaman MPMC)
+// - Boş kuyrukta tüketici, Block politikasında dolu kuyrukta üretici
+//   condition variable'da uyur; uyuyan yoksa bildirim kilit almaz
+// - MetricsCollector verilirse: aşama adıyla öğe başına süre (adet ->
+//   throughput, p50/p99) ve "<aşama>.queue" göstergesiyle kuyruk derinliği
+// - push() tek bir kaynak thread'den çağrılmalıdır
+//
+// Örnek:
+//   Pipeline<Frame> p(&metrics);
+//   p.addStage("capture", [](Frame& f) { ...; return true; }, {0});
+//   p.addStage("infer",   [](Frame& f) { ...; return true; }, {1, 2});
+//   p.start();
+//   while (...) p.push(grab());
+//   p.stop();  // Kuyruktakileri bitirir
+template <typename T>
+class Pipeline {
+public:
+    // false dönerse öğe sonraki aşamalara geçmez (filtre)
+    using StageFn = std::function<bool(T&)>;
+
+    explicit Pipeline(MetricsCollector* metrics = nullptr) : metrics_(metrics) {}
+    ~Pipeline() { stop(); }
+
+    Pipeline(const Pipeline&) = delete;
+    Pipeline& operator=(const Pipeline&) = delete;
+
+    // start()'tan önce çağrılmalı; aşama indeksini döner
+    size_t addStage(const std::string& name, StageFn fn, StageOptions options = {}) {
+        auto stage = std::make_unique<Stage>();
+        stage->name = name;
+        stage->fn = std::move(fn);
+        if (options.workers == 0) options.workers = 1;
+        stage->options = options;
+        if (metrics_) {
+            stage->nameId = metrics_->internName(name);
+            stage->gaugeId = metrics_->registerGauge(name + ".queue");
+        }
+        stages_.push_back(std::move(stage));
+        return stages_.size() - 1;
+    }
+
+    void start() {
+        if (running_ || stages_.empty()) return;
+
+        for (size_t i = 0; i < stages_.size(); ++i) {
+            Stage& s = *stages_[i];
+            size_t producers = i == 0 ? 1 : stages_[i - 1]->options.workers;
+            bool spsc = producers == 1 && s.options.workers == 1 &&
+                        s.options.overflow != OverflowPolicy::DropOldest;
+            if (spsc) {
+                s.spsc = std::make_unique<SpscQueue<T>>(s.options.capacity);
+            } else {
+                s.mpmc = std::make_unique<MpmcQueue<T>>(s.options.capacity);
+            }
+            s.closed = false;
+        }
+
+        startTime_ = std::chrono::steady_clock::now();
+        running_ = true;
+        for (size_t i = 0; i < stages_.size(); ++i) {
+            Stage& s = *stages_[i];
+            for (size_t w = 0; w < s.options.workers; ++w) {
+                s.threads.emplace_back([this, i]() { stageLoop(i); });
+                if (s.options.core >= 0) {
+                    setThreadAffinity(s.threads.back(), {s.options.core});
+                }
+            }
+        }
+        JTS_LOG_INFO("[Pipeline] %zu aşama başlatıldı", stages_.size());
+    }
+
+    // Kaynaktan bir öğe ver. false: atıldı (DropNewest) veya pipeline kapalı
+    bool push(T item) {
+        if (!running_) return false;
+        return enqueue(0, item);
+    }
+
+    // Yeni öğe kabul etmeyi bırak, kuyruktakileri sırayla bitir, thread'leri topla
+    void stop() {
+        if (!running_.exchange(false)) return;
+
+        // Aşama i, üreticileri (i-1) bittikten sonra kapatılır: kuyrukta
+        // kalan her öğe işlenir
+        for (auto& stage : stages_) {
+            stage->closed = true;
+            stage->notEmpty.notify();
+            for (auto& t : stage->threads) {
+                if (t.joinable()) t.join();
+            }
+            stage->threads.clear();
+        }
+        JTS_LOG_INFO("[Pipeline] Durduruldu");
+    }
+
+    std::vector<StageStats> stats() const {
+        double secs = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime_).count();
+        std::vector<StageStats> out;
+        for (const auto& s : stages_) {
+            uint64_t processed = s->processed.load(std::memory_order_relaxed);
+            out.push_back({s->name, processed,
+                           s->dropped.load(std::memory_order_relaxed),
+                           s->filtered.load(std::memory_order_relaxed),
+                           s->size(), s->capacity(),
+                           secs > 0 ? processed / secs : 0.0});
+        }
+        return out;
+    }
+
+    size_t stageCount() const { return stages_.size(); }
+
+private:
+    // Uyuyan bekleyici varsa uyandıran olay; yoksa bildirim kilit almaz
+    struct Signal {
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<int> sleepers{0};
+
+        template <typename Pred>
+        void wait(Pred ready) {
+            sleepers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, ready);
+            }
+            sleepers.fetch_sub(1);
+        }
+
+        void notify() {
+            // Kuyruğa yazma ile sleepers okuması yer değiştirmesin
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (sleepers.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(mutex);
+                cv.notify_all();
+            }
+        }
+    };
+
+    struct Stage {
+        std::string name;
+        StageFn fn;
+        StageOptions options;
+
+        std::unique_ptr<SpscQueue<T>> spsc;  // Biri dolu, diğeri boş
+        std::unique_ptr<MpmcQueue<T>> mpmc;
+        Signal notEmpty;
+        Signal notFull;
+        std::atomic<bool> closed{false};
+        std::vector<std::thread> threads;
+
+        std::atomic<uint64_t> processed{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> filtered{0};
+        std::atomic<uint64_t> seq{0};
+        uint32_t nameId = 0;
+        uint32_t gaugeId = MetricsCollector::kInvalidGauge;
+
+        bool tryPush(T& v) { return spsc ? spsc->tryPush(v) : mpmc->tryPush(v); }
+        bool tryPop(T& v) { return spsc ? spsc->tryPop(v) : mpmc->tryPop(v); }
+        size_t size() const { return spsc ? spsc->size() : mpmc ? mpmc->size() : 0; }
+        size_t capacity() const {
+            return spsc ? spsc->capacity() : mpmc ? mpmc->capacity() : options.capacity;
+        }
+    };
+
+    bool enqueue(size_t index, T& item) {
+        Stage& s = *stages_[index];
+        switch (s.options.overflow) {
+            case OverflowPolicy::Block:
+                while (!s.tryPush(item)) {
+                    s.notFull.wait([&s]() { return s.size() < s.capacity(); });
+                }
+                break;
+            case OverflowPolicy::DropNewest:
+                if (!s.tryPush(item)) {
+                    s.dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                break;
+            case OverflowPolicy::DropOldest:
+                while (!s.tryPush(item)) {
+                    T old;
+                    if (s.tryPop(old)) s.dropped.fetch_add(1, std::memory_order_relaxed);
+                }
+                break;
+        }
+        if (metrics_) metrics_->setGauge(s.gaugeId, static_cast<int64_t>(s.size()));
+        s.notEmpty.notify();
+        return true;
+    }
+
+    void stageLoop(size_t index) {
+        Stage& s = *stages_[index];
+        const bool last = index + 1 == stages_.size();
+        T item;
+        while (true) {
+            if (s.tryPop(item)) {
+                s.notFull.notify();
+
+                bool keep;
+                if (metrics_) {
+                    auto token = metrics_->recordStart(s.seq.fetch_add(1, std::memory_order_relaxed),
+                                                       s.nameId);
+                    keep = s.fn(item);
+                    metrics_->recordEnd(token, keep);
+                } else {
+                    keep = s.fn(item);
+                }
+                s.processed.fetch_add(1, std::memory_order_relaxed);
+
+                if (!keep) {
+                    s.filtered.fetch_add(1, std::memory_order_relaxed);
+                } else if (!last) {
+                    enqueue(index + 1, item);
+                }
+                continue;
+            }
+
+            // Kapalı ve boş: üreticiler bitti, çık
+            if (s.closed.load(std::memory_order_acquire) && s.size() == 0) break;
+
+            s.notEmpty.wait([&s]() {
+                return s.size() > 0 || s.closed.load(std::memory_order_acquire);
+            });
+        }
+    }
+
+    MetricsCollector* metrics_;
+    std::vector<std::unique_ptr<Stage>> stages_;
+    std::atomic<bool> running_{false};
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+} // namespace jts
+
+#endif
@@ -12,13 +12,38 @@
  * - Scheduler en yüksek öncelikli görevi seçip çalıştırır
  * - Ayrı bir thread'de sürekli çalışabilir (start/stop)
  * - Thread-safe: std::atomic ile durum yönetimi
+ * - Olay güdümlü: boştaki worker condition variable'da uyur,
+ *   addTask() ve stop() onu anında uyandırır (polling yok)
+ * - Çoklu worker modu: her worker bir çekirdeğe sabitlenir, görevler
+ *   cpu_cores kümesine uyan worker'a dağıtılır
+ * - Yürütme alanları (SchedulerOptions): her TaskType kendi worker
+ *   kümesine gider; diske takılan IO görevi CPU görevlerini bekletmez
+ * - Periyodik görevler çalıştıktan sonra aynı ID ile yeniden kurulur;
+ *   aynı öncelik bandında en erken son tarih önce çalışır (EDF)
+ * - Tamamlanma beklenebilir: wait(ids)/waitIdle() condition variable'da
+ *   uyur, submit() sonucu Future olarak verir (sabit uyku gerekmez)
+ * - Gecikmeli görevler (addTaskAt/addTaskAfter, faz, periyodik yeniden
+ *   kurma) registry'nin zamanlama tekerleğinde bekler; ayrı bir zamanlayıcı
+ *   thread'i en yakın ana kadar mutlak zamanlı uyur ve zamanı gelenleri
+ *   hazır kümeye taşır
+ * - Kabul kontrolü (AdmissionOptions): wcet ve periyot bildiren görev,
+ *   çekirdeğin kullanım payı sınırı (EDF / Liu-Layland) aşılacaksa
+ *   reddedilir ya da realtime olmayan düşük önceliğe indirilir; ölçülen
+ *   süre wcet'i aşınca bütçe aşımı sayılır
  * 
  * KULLANIM:
  *   Scheduler s;
- *   s.addTask(görev);     // Görev ekle
+ *   s.addTask(görev);     // Görev ekle (kabul reddederse ID 0)
  *   s.start();            // Arka planda çalıştır
  *   // ... işlemler ...
+ *   s.waitIdle();         // Hepsi bitene kadar bekle
  *   s.stop();             // Durdur
+ *
+ *   Scheduler multi(4);   // 4 worker, çekirdek 0-3'e sabitli
+ *
+ *   SchedulerOptions opts;  // CPU: sabitli, IO: fazla abonelikli, GPU: sıralı
+ *   opts.io.workers = 8;
+ *   Scheduler domains(opts);
  * ============================================================================
  */
 
@@ -30,9 +55,114 @@
 #include <atomic>            // std::atomic - thread-safe değişkenler için
 #include <thread>            // std::thread - arka plan iş parçacığı için
 #include <chrono>            // Zaman işlemleri için (sleep, duration)
+#include <mutex>             // std::mutex - uyandırma kilidi için
+#include <condition_variable> // std::condition_variable - boşta bekleme için
+#include <memory>            // std::unique_ptr - Worker nesneleri için
+#include <vector>            // std::vector - worker listesi için
+#include <unordered_map>     // std::unordered_map - kabul kontrolü payları için
+#include <type_traits>       // std::invoke_result_t - submit() dönüş tipi için
+#include "future.hpp"        // Future / Promise
 
 namespace jts {
 
+class MetricsCollector;  // metrics.hpp - alan başına süre ve kuyruk göstergesi
+
+/**
+ * ----------------------------------------------------------------------------
+ * DomainOptions / SchedulerOptions - Yürütme Alanları
+ * ----------------------------------------------------------------------------
+ * Her TaskType ayrı bir worker kümesinde çalışır; dağıtıcı görevi türünün
+ * alanındaki en az yüklü worker'a verir:
+ * - CPU: çekirdek başına sabitli hesaplama worker'ları
+ * - IO:  çekirdek sayısından fazla, sabitlenmemiş worker (bloklanan okuma /
+ *        yazma sırasında diğerleri ilerler)
+ * - GPU: cihaz kuyruğuna gönderimi sıralayan tek thread; görevler dağıtım
+ *        sırasıyla (öncelik, EDF, FIFO) birer birer çalışır. Sadece gönderim
+ *        sırası modellenir, GPU gerekmez.
+ * workers = 0 alanın varsayılanıdır; disabled = true alanı kapatır (o türün
+ * görevleri CPU alanına düşer).
+ */
+struct DomainOptions {
+    size_t workers = 0;       // 0: CPU sayısı (CPU), 2 x CPU sayısı (IO), 1 (GPU)
+    bool pin = false;         // Her worker tek çekirdeğe sabitlenir
+    bool disabled = false;    // Alan yok, görevler CPU alanında çalışır
+    std::vector<int> cores;   // pin: sırayla atanır, değilse izinli küme (boş: Topology / kısıtsız)
+};
+
+/**
+ * ----------------------------------------------------------------------------
+ * AdmissionOptions - Kullanım Payına Dayalı Kabul Kontrolü
+ * ----------------------------------------------------------------------------
+ * Sınanan görevler: period > 0 ve wcet > 0 olanlar. Görevin payı
+ * u = wcet / min(deadline, period) (deadline 0 ise period). Diğer görevler
+ * (tek seferlik, wcet bildirmeyen) sınanmaz ve pay ayırmaz.
+ *
+ * Bölümlenmiş zamanlama: her sabitli çekirdek ayrı bir işlemcidir. Görev
+ * cpu_cores kümesindeki (boşsa alanındaki) çekirdeklerden sınavı geçen en
+ * boş olana atanır ve cpu_cores o çekirdeğe daraltılır; dağıtıcı görevi
+ * hep orada çalıştırır. Tek thread modunda tek işlemci vardır.
+ * Sabitlenmemiş worker'lı alan (IO/GPU varsayılanı) m işlemcili tek bir
+ * küresel kümedir: U <= capacity * (m - (m - 1) * u_max) (Goossens-Funk-
+ * Baruah, küresel EDF). Bu sınır iki politikada da kullanılır.
+ *
+ * Politikalar (çekirdek başına, n: görev sayısı, yeni görev dahil):
+ * - Edf:           U <= capacity
+ * - RateMonotonic: U <= capacity * n * (2^(1/n) - 1)  (Liu-Layland; n
+ *                  büyüdükçe ~0.69'a iner)
+ *
+ * Sınavı geçemeyen görev onFail'e göre reddedilir (addTask 0 döner) ya da
+ * realtime bayrağı kaldırılıp demotedPriority'ye indirilerek pay
+ * ayırmadan eklenir. wcet'i son tarihten büyük görev hiçbir çekirdeğe
+ * sığmaz. Pay cancelTask() ile geri verilir.
+ */
+enum class AdmissionPolicy {
+    None,           // Kabul kontrolü yok (varsayılan)
+    Edf,
+    RateMonotonic
+};
+
+enum class AdmissionAction {
+    Reject,         // Görev eklenmez
+    Demote          // Realtime olmayan, düşük öncelikli görev olarak eklenir
+};
+
+struct AdmissionOptions {
+    AdmissionPolicy policy = AdmissionPolicy::None;
+    AdmissionAction onFail = AdmissionAction::Reject;
+    double capacity = 1.0;     // Çekirdek başına ayrılabilecek pay (ör. 0.9: %10 boşluk)
+    int demotedPriority = 0;   // Demote: yeni öncelik (mevcut öncelikten yüksekse kullanılmaz)
+};
+
+struct SchedulerOptions {
+    DomainOptions cpu{0, true, false, {}};
+    DomainOptions io{0, false, false, {}};
+    DomainOptions gpu{1, false, false, {}};
+    // Verilirse alan başına görev süresi ("domain.CPU") ve dağıtılmış ama
+    // başlamamış görev sayısı ("domain.CPU.queue") kaydedilir
+    MetricsCollector* metrics = nullptr;
+    AdmissionOptions admission;
+};
+
+// Kabul kontrolü sayaçları (Scheduler::admissionStats)
+struct AdmissionStats {
+    uint64_t admitted;         // Sınanıp pay ayrılan görev
+    uint64_t rejected;
+    uint64_t demoted;
+    uint64_t budget_overruns;  // wcet'i aşan aktivasyon (tüm görevler)
+};
+
+// Alan başına sayaçlar (Scheduler::domainStats)
+struct DomainStats {
+    TaskType type;
+    size_t workers;            // 0: alan yok, görevler CPU alanında
+    uint64_t executed;         // Bu alanda biten aktivasyon
+    uint64_t deadline_misses;
+    uint64_t budget_overruns;  // wcet'ten uzun süren aktivasyon
+    size_t queued;             // Anlık: dağıtılmış, başlamamış
+    size_t max_queued;
+    double busy_ms;            // Worker'ların görev çalıştırdığı toplam süre
+};
+
 /**
  * ----------------------------------------------------------------------------
  * Scheduler sınıfı - Görev Zamanlayıcı
@@ -44,14 +174,41 @@ namespace jts {
  * - Tek seferlik çalıştırma (runOnce)
  * - Sürekli arka plan çalıştırma (start/stop)
  * - Thread-safe durum yönetimi
+ * - İsteğe bağlı çoklu worker modu (çekirdek başına bir worker)
  */
 class Scheduler {
 public:
     /**
      * Yapıcı fonksiyon (Constructor)
      * Zamanlayıcıyı başlatır, varsayılan durumda çalışmıyor (running_=false)
+     * Görevler tek bir arka plan thread'inde sırayla çalıştırılır.
      */
     Scheduler();
+
+    /**
+     * Çoklu Worker Yapıcısı
+     * numWorkers adet worker oluşturur; çekirdekler Topology::placement()
+     * sırasıyla atanır (aynı L2/L3'ü paylaşanlar art arda, izole CPU'lar
+     * en sonda; CPU'dan fazla worker varsa baştan tekrarlanır). start() çağrıldığında bir dağıtıcı thread
+     * registry'den en yüksek öncelikli görevi alır ve cpu_cores kümesine
+     * uyan en az yüklü worker'ın kuyruğuna koyar.
+     *
+     * Realtime görevler worker'da SCHED_FIFO ile çalışır; realtime olmayan
+     * bir sonraki görevden önce worker SCHED_OTHER'a döner (yetki yoksa
+     * hep normal zamanlamada devam eder).
+     *
+     * @param numWorkers Worker sayısı (0 = CPU sayısı kadar)
+     */
+    explicit Scheduler(size_t numWorkers);
+
+    /**
+     * Yürütme Alanları Yapıcısı
+     * CPU, IO ve GPU görevleri için ayrı worker kümeleri kurar (bkz.
+     * SchedulerOptions). Dağıtım ve realtime yükseltme çoklu worker modu
+     * ile aynıdır; cpu_cores sadece sabitli worker'lar arasında seçimde
+     * kullanılır. Scheduler(n), n worker'lı tek bir CPU alanına eşdeğerdir.
+     */
+    explicit Scheduler(const SchedulerOptions& options);
     
     /**
      * Yıkıcı fonksiyon (Destructor)
@@ -67,11 +224,110 @@ public:
     /**
      * addTask() - Yeni Görev Ekle
      * Görevi registry'ye kaydeder ve benzersiz ID döndürür.
+     * Arka plan worker'ı boşta bekliyorsa hemen uyandırılır.
      * 
+     * İkinci biçim iş fonksiyonunu doğrudan TaskFunction olarak alır:
+     * 64 bayta kadar yakalaması olan lambda için hiç heap allocation
+     * yapılmaz (std::function ara adımı yoktur).
+     *
+     * Kabul kontrolü açıksa (setAdmission) periyodik, wcet bildiren görev
+     * önce sınanır; reddedilirse registry'ye eklenmez ve 0 döner.
+     * cpu_cores CpuMask'e sığmayan çekirdek (< 0 ya da >= 64) içeren görev
+     * de eklenmez (0), sessizce sabitlenmemiş çalışmaz.
+     *
      * @param task Eklenecek görev
-     * @return Atanan benzersiz görev ID'si
+     * @param work İş fonksiyonu (task.work yerine)
+     * @return Atanan benzersiz görev ID'si (0: kabul edilmedi)
      */
     uint64_t addTask(Task task);
+    uint64_t addTask(Task task, TaskFunction work);
+
+    /**
+     * addTasks() - Toplu Görev Ekle
+     * Görevleri registry'ye tek kilit altında kaydeder ve worker'ı bir kez
+     * uyandırır (görev başına kilit + bildirim yerine). Kare başına çok
+     * sayıda küçük görev (ör. karo bazlı ön işleme) için.
+     *
+     * @param tasks Eklenecek görevler
+     * @return Atanan ID'ler, tasks ile aynı sırada (wait() ile beklenebilir;
+     *         kabul edilmeyenler 0)
+     */
+    std::vector<uint64_t> addTasks(std::vector<Task> tasks);
+
+    /**
+     * addTaskAt() / addTaskAfter() - Gecikmeli Görev Ekle
+     * Görev when anına (ya da şimdi + delay) kadar zamanlama tekerleğinde
+     * bekler, sonra normal öncelik kurallarıyla çalışır. task.phase yok
+     * sayılır; periyodik görevin sonraki aktivasyonları when'den itibaren
+     * sayılır. Geçmişteki an hemen hazır demektir.
+     *
+     * Ekleme ve cancelTask() ile iptal O(1)'dir; tekerlekte bekleyen görev
+     * çalışmadan iptal edilebilir.
+     *
+     * Örnek:
+     *   s.addTaskAfter(watchdog, std::chrono::milliseconds(500));
+     *
+     * @return Atanan benzersiz görev ID'si (0: kabul edilmedi)
+     */
+    uint64_t addTaskAt(Task task, std::chrono::steady_clock::time_point when);
+    uint64_t addTaskAt(Task task, TaskFunction work, std::chrono::steady_clock::time_point when);
+    uint64_t addTaskAfter(Task task, std::chrono::steady_clock::duration delay);
+    uint64_t addTaskAfter(Task task, TaskFunction work, std::chrono::steady_clock::duration delay);
+
+    /**
+     * submit() - Sonucu Future Olarak Dönen Görev
+     * fn tek seferlik görev olarak eklenir (task.period yok sayılır);
+     * dönüş değeri veya fırlattığı istisna Future'a yazılır. Görev
+     * çalışmadan iptal edilirse Future hiç hazır olmaz.
+     *
+     * Örnek:
+     *   auto f = s.submit(desc, []() { return detect(); });
+     *   auto boxes = f.get();   // Biter bitmez uyanır, istisnayı yeniden fırlatır
+     */
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>&>>
+    Future<R> submit(Task task, F&& fn) {
+        Promise<R> promise;
+        Future<R> future = promise.getFuture();
+        task.period = std::chrono::milliseconds(0);
+        addTask(std::move(task),
+                [promise, fn = std::forward<F>(fn)]() mutable { promise.fulfill(fn); });
+        return future;
+    }
+
+    /**
+     * wait() / waitFor() - Görev(ler)in Bitmesini Bekle
+     * Verilen ID'lerin hepsi tamamlanana (veya iptal edilene) kadar
+     * condition variable'da uyur; görev bitince çalıştıran thread uyandırır.
+     * Bilinmeyen ID hemen "bitti" sayılır. Periyodik görev ancak iptal
+     * edilince biter.
+     *
+     * Zamanlayıcı çalışmıyorsa (start() yok) görevler bu thread'de
+     * runOnce() ile yürütülür.
+     *
+     * @return waitFor: true hepsi bitti, false süre doldu
+     */
+    void wait(uint64_t id);
+    void wait(const std::vector<uint64_t>& ids);
+    bool waitFor(const std::vector<uint64_t>& ids, std::chrono::milliseconds timeout);
+
+    /**
+     * waitIdle() - Bariyer
+     * Registry'de ve worker kuyruklarında bitmemiş görev kalmayana kadar
+     * bekler. Periyodik görev varsa o iptal edilene kadar dönmez.
+     */
+    void waitIdle();
+
+    /**
+     * cancelTask() - Görevi İptal Et
+     * Hazır, aktivasyon bekleyen (zamanlama tekerleğindeki, addTaskAt ile
+     * eklenenler dahil) veya o an çalışan periyodik görevi iptal eder
+     * (çalışan görev bitirilir ama yeniden kurulmaz). Görevin kabul
+     * kontrolünde ayrılan payı serbest kalır.
+     *
+     * @param id İptal edilecek görevin ID'si
+     * @return true: iptal edildi, false: görev bulunamadı
+     */
+    bool cancelTask(uint64_t id);
 
     // =========================================================================
     // ÇALIŞTIRMA MODLARI
@@ -89,6 +345,7 @@ public:
     /**
      * start() - Sürekli Çalıştırmayı Başlat
      * Ayrı bir thread oluşturur ve görevleri sürekli çalıştırır.
+     * Gecikmeli görevler için zamanlayıcı thread'i de başlatılır.
      * stop() çağrılana kadar devam eder.
      * 
      * NOT: Birden fazla kez çağrılmamalı (zaten çalışıyorsa etkisiz)
@@ -97,7 +354,8 @@ public:
     
     /**
      * stop() - Çalışmayı Durdur
-     * running_ bayrağını false yapar ve worker thread'in bitmesini bekler.
+     * running_ bayrağını false yapar, boşta bekleyen worker'ı uyandırır
+     * ve worker thread'in bitmesini bekler.
      * Thread-safe: İstediğiniz thread'den çağrılabilir
      */
     void stop();
@@ -114,13 +372,50 @@ public:
     
     /**
      * pendingCount() - Bekleyen Görev Sayısı
-     * @return Registry'deki toplam görev sayısı
+     * @return Registry'deki ve worker kuyruklarındaki toplam görev sayısı
      */
     size_t pendingCount() const;
+
+    /**
+     * workerCount() - Worker Sayısı
+     * @return Çoklu worker modunda worker sayısı, tek thread modunda 0
+     */
+    size_t workerCount() const;
+
+    /**
+     * deadlineMisses() - Toplam Son Tarih Kaçırma Sayısı
+     * Görev başına sayı için: registry().getTask(id)->deadline_misses
+     * @return Tüm görevlerde son tarihinden sonra biten aktivasyon sayısı
+     */
+    uint64_t deadlineMisses() const;
+
+    /**
+     * domainStats() - Yürütme Alanı Sayaçları
+     * Tek thread modunda tüm alanlar boştur (workers = 0).
+     */
+    DomainStats domainStats(TaskType type) const;
+
+    /**
+     * setAdmission() - Kabul Kontrolünü Ayarla
+     * Sonraki eklemelerden itibaren geçerlidir; önceden eklenmiş görevler
+     * pay ayırmamış sayılır, bu yüzden görevlerden önce çağrılmalıdır.
+     * SchedulerOptions::admission ile aynıdır.
+     */
+    void setAdmission(const AdmissionOptions& options);
+
+    /**
+     * admissionStats() / reservedUtilization() - Kabul Durumu
+     * reservedUtilization(core): o çekirdekte ayrılmış toplam pay (0-1).
+     * core = -1 tek thread modunun işlemcisi ve sabitlenmemiş alanlardır
+     * (küresel kümenin payı işlemci sayısına bölünmeden verilir).
+     */
+    AdmissionStats admissionStats() const;
+    double reservedUtilization(int core) const;
     
     /**
      * registry() - Registry'ye Erişim
-     * Doğrudan registry'ye erişim sağlar (ileri düzey kullanım için)
+     * Doğrudan registry'ye erişim sağlar (ileri düzey kullanım için).
+     * removeTask()/clear() ile çıkan görevlerin kabul payı da serbest kalır.
      * @return TaskRegistry referansı
      */
     TaskRegistry& registry();
@@ -147,6 +442,139 @@ private:
      */
     std::thread workerThread_;
 
+    /**
+     * wakeMutex_ / wakeCv_ - Uyandırma Mekanizması
+     * Hazır görev yokken worker wakeCv_ üzerinde bekler (CPU harcamaz).
+     * addTask(), zamanlayıcı thread'i ve stop() bekleyen worker'ı uyandırır.
+     * Koşul wakeMutex_ altında kontrol edildiği için uyandırma kaybolmaz.
+     */
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    uint64_t wakeGen_ = 0;  // Her bildirimde artar (wakeMutex_ altında)
+
+    std::atomic<uint64_t> deadlineMisses_{0};
+    std::atomic<uint64_t> budgetOverruns_{0};
+
+    /**
+     * timerThread_ / timerWord_ / timerTarget_ - Zamanlayıcı Thread'i
+     * Tekerleğin en yakın anına kadar timerWord_ üzerinde mutlak zamanlı
+     * futex beklemesiyle uyur (FUTEX_WAIT_BITSET, CLOCK_MONOTONIC), uyanınca
+     * zamanı gelen görevleri hazır heap'e taşır ve worker'ı uyandırır.
+     * timerTarget_ thread'in uyanacağı an (ns); daha erken bir görev
+     * eklenirse kickTimer() timerWord_'ü artırıp thread'i uyandırır.
+     * Hesaplama sırasında INT64_MAX'tir: o arada gelen her ekleme uyandırır.
+     */
+    std::thread timerThread_;
+    std::atomic<uint32_t> timerWord_{0};
+    std::atomic<int64_t> timerTarget_{INT64_MAX};
+
+    /**
+     * doneMutex_ / doneCv_ - Tamamlanma Bildirimi
+     * wait()/waitIdle() burada uyur. Görev bitince veya iptal edilince
+     * doneWaiters_ > 0 ise uyandırılır; bekleyen yoksa sıcak yolda kilit
+     * alınmaz.
+     */
+    std::mutex doneMutex_;
+    std::condition_variable doneCv_;
+    std::atomic<int> doneWaiters_{0};
+
+    /**
+     * Worker - Çekirdeğe Sabitli Yürütücü
+     * Her worker'ın kendi kuyruğu ve uyandırma değişkeni vardır; dağıtıcı
+     * ile worker arasında sadece bu kuyruğun kilidi paylaşılır.
+     * Kuyruk registry'den ödünç alınmış görev işaretçilerini tutar; vektör
+     * boşaldığında kapasitesi korunarak sıfırlanır (kararlı durumda
+     * allocation yok).
+     */
+    struct Worker {
+        int core = 0;                  // Sabitlendiği çekirdek (-1: sabitlenmemiş)
+        TaskType domain = TaskType::CPU;
+        std::vector<int> allowed;      // Sabitlenmemişse izinli çekirdekler (boş: kısıtsız)
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<ScheduledTask*> queue;  // Dağıtılmış görevler (queueHead'den itibaren)
+        size_t queueHead = 0;
+        std::atomic<size_t> load{0};   // Kuyruktaki + çalışan görev sayısı
+        bool fifo = false;             // Şu an SCHED_FIFO'da mı
+        bool realtimeDenied = false;   // SCHED_FIFO yetkisi yok (tekrar denenmez)
+        bool stop = false;             // Kuyruğu bitir ve çık (mutex altında)
+    };
+
+    /**
+     * workers_ - Worker Listesi
+     * Boşsa tek thread modu (workerThread_ görevleri kendisi çalıştırır).
+     * Doluysa workerThread_ sadece dağıtıcıdır.
+     */
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    /**
+     * Domain - Yürütme Alanı
+     * workers: workers_ içindeki bu alanın worker'ları (boşsa görevler CPU
+     * alanına gider). Sayaçlar worker'lar tarafından kilitsiz güncellenir.
+     */
+    struct Domain {
+        std::vector<Worker*> workers;
+        std::atomic<uint64_t> executed{0};
+        std::atomic<uint64_t> misses{0};
+        std::atomic<uint64_t> overruns{0};
+        std::atomic<int64_t> busyNs{0};
+        std::atomic<size_t> queued{0};
+        std::atomic<size_t> maxQueued{0};
+        uint32_t nameId = 0;           // metrics_ içindeki "domain.<tür>"
+        uint32_t gaugeId = UINT32_MAX; // "domain.<tür>.queue"
+    };
+    static constexpr size_t kDomains = 3;  // TaskType değer sayısı
+    Domain domains_[kDomains];
+    MetricsCollector* metrics_ = nullptr;
+
+    /**
+     * addWorkers() - Alana Worker Ekle
+     * count adet worker; pin ise sırayla cores'a (boşsa Topology
+     * yerleşimine) sabitlenir, değilse cores izinli kümedir.
+     */
+    void addWorkers(TaskType type, size_t count, bool pin, const std::vector<int>& cores);
+    Domain& domainOf(TaskType type) { return domains_[static_cast<size_t>(type)]; }
+
+    /**
+     * Kabul Kontrolü
+     * Her işlemci bir AdmissionBin'dir: sabitli çekirdek (alan başına), bir
+     * alanın sabitlenmemiş worker'ları (küresel, processors = worker
+     * sayısı) ya da tek thread modunda tek kutu. Kutular addWorkers()
+     * sırasında kurulur; paylar ve reservations_ admissionMutex_ altında
+     * değişir (sadece ekleme / iptal yolunda, dağıtım yolunda değil).
+     */
+    struct AdmissionBin {
+        TaskType domain = TaskType::CPU;
+        int core = -1;             // -1: küresel / tek thread
+        size_t processors = 1;
+        double utilization = 0.0;  // Ayrılmış toplam pay
+        size_t tasks = 0;
+    };
+    struct Reservation {
+        size_t bin;
+        double share;
+    };
+    mutable std::mutex admissionMutex_;
+    AdmissionOptions admission_;
+    std::vector<AdmissionBin> bins_;
+    std::unordered_map<uint64_t, Reservation> reservations_;
+    uint64_t admitted_ = 0;
+    uint64_t rejected_ = 0;
+    uint64_t demoted_ = 0;
+
+    /**
+     * admit() - Görevi Sına ve Pay Ayır
+     * Sınanmayan görevde true ve reservation.bin = SIZE_MAX. Geçerse payı
+     * ayırır, bölümlenmiş kutuda cpu_cores'u kutunun çekirdeğine daraltır.
+     * Geçemezse onFail'e göre false (reddet) ya da görevi indirip true.
+     */
+    bool admit(Task& task, Reservation& reservation);
+    void bindReservation(uint64_t id, const Reservation& reservation);  // Kayıttan sonra
+    void releaseReservation(uint64_t id);
+    void buildAdmissionBins();  // Yapıcıların sonunda, worker'lar kurulduktan sonra
+    bool fits(const AdmissionBin& bin, double share, double maxShare) const;
+
     // =========================================================================
     // ÖZEL YARDIMCI FONKSİYONLAR
     // =========================================================================
@@ -159,6 +587,74 @@ private:
      * @return true: Görev çalıştırıldı, false: Görev bulunamadı
      */
     bool executeNextTask();
+
+    /**
+     * runTask() - Görevi Çalıştır
+     * work fonksiyonunu çağırır, süreyi ölçer ve loglar. Son tarih
+     * kaçırmasını ve bütçe aşımını belirler; görev sayaçları ve periyodik
+     * yeniden kurma registry'nin complete()'inde, kilit altında yapılır
+     * (getTask() çalışan görevi yarışsız okur).
+     * Hem tek thread modu hem worker'lar tarafından kullanılır.
+     * complete()'ten sonra task'a dokunulmaz. wcet bildiren görevin süresi bütçeyle
+     * karşılaştırılır (ilk aşımda uyarı loglanır).
+     */
+    struct RunOutcome {
+        bool missed = false;   // Son tarih kaçırıldı
+        bool overrun = false;  // wcet aşıldı
+    };
+    RunOutcome runTask(ScheduledTask& task);
+
+    /**
+     * dispatchLoop() / workerLoop() - Çoklu Worker Modu Döngüleri
+     * dispatchLoop: registry'den görev alıp worker kuyruklarına dağıtır
+     * workerLoop:   kendi kuyruğundaki görevleri sırayla çalıştırır
+     */
+    void dispatchLoop();
+    void workerLoop(Worker& worker);
+
+    /**
+     * pickWorker() - Görev İçin Worker Seç
+     * Adaylar görevin türünün alanıdır (alan yoksa CPU alanı).
+     * cpu_cores kümesine uyan worker'lar arasından en az yüklü olanı döner.
+     * Hiçbiri uymuyorsa istenen çekirdeklerle aynı cache grubundaki
+     * worker'lar, o da yoksa (veya cpu_cores boşsa) tüm worker'lar adaydır.
+     */
+    Worker& pickWorker(const ScheduledTask& task);
+
+    /**
+     * notifyWorker() - Bekleyen Worker'ı Uyandır
+     * Yeni görev geldiğinde çağrılır.
+     */
+    void notifyWorker();
+
+    /**
+     * timerLoop() / armTimer() / kickTimer() - Zamanlayıcı Thread'i
+     * armTimer: gelecekteki release zamanlayıcının hedefinden erkense uyandırır
+     * kickTimer: koşulsuz uyandırır (stop())
+     */
+    void timerLoop();
+    void armTimer(std::chrono::steady_clock::time_point release);
+    void kickTimer();
+
+    /**
+     * notifyDone() - Tamamlanma Bekleyenlerini Uyandır
+     */
+    void notifyDone();
+
+    /**
+     * waitUntil() - Koşul Sağlanana Kadar Bekle
+     * wait()/waitIdle() ortak gövdesi. deadline boşsa süresiz.
+     * @return true: koşul sağlandı, false: süre doldu
+     */
+    template <typename Pred>
+    bool waitUntil(Pred done, const std::chrono::steady_clock::time_point* deadline);
+
+    /**
+     * waitForWork() - Hazır Görev Bekle
+     * Yeni görev, zamanlayıcı thread'inin bildirimi veya stop() gelene
+     * kadar uyur (aktivasyon anlarını zamanlayıcı thread'i izler).
+     */
+    void waitForWork();
 };
 
 } // namespace jts
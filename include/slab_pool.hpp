@@ -0,0 +1,85 @@
+#ifndef SLAB_POOL_HPP
+#define SLAB_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace jts {
+
+// Sabit boyutlu nesne havuzu
+// - Bellek ChunkSize nesnelik bloklar halinde ayrılır ve havuz yok edilene
+//   kadar geri verilmez; adresler kararlıdır
+// - destroy() edilen yer serbest listeye döner, sonraki create() onu kullanır:
+//   kararlı durumda allocation yapılmaz
+// - Thread-safe değildir; sahibi (ör. TaskRegistry) kendi kilidiyle korur
+// - create() kurucu fırlatırsa yer serbest listede kalır, live() değişmez
+// - Havuz yok edilmeden önce canlı nesneler destroy() edilmiş olmalıdır
+template <typename T, size_t ChunkSize = 64>
+class SlabPool {
+public:
+    SlabPool() = default;
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    template <typename... A>
+    T* create(A&&... args) {
+        if (!freeList_) grow();
+        FreeNode* node = freeList_;
+        FreeNode* next = node->next;
+        T* object;
+        try {
+            object = ::new (static_cast<void*>(node)) T(std::forward<A>(args)...);
+        } catch (...) {
+            // Kurucu yarıda yazmış olabilir: bağı yeniden kur, yer listede kalsın
+            ::new (static_cast<void*>(node)) FreeNode{next};
+            throw;
+        }
+        freeList_ = next;  // Yalnız kurulum başarılıysa kullanılmış say
+        ++live_;
+        return object;
+    }
+
+    void destroy(T* object) {
+        object->~T();
+        FreeNode* node = ::new (static_cast<void*>(object)) FreeNode{freeList_};
+        freeList_ = node;
+        --live_;
+    }
+
+    // İlk create()'lerde büyümemek için önceden yer ayır
+    void reserve(size_t count) {
+        while (capacity() < count) grow();
+    }
+
+    size_t live() const { return live_; }
+    size_t capacity() const { return chunks_.size() * ChunkSize; }
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    union alignas(T) Cell {
+        unsigned char bytes[sizeof(T) > sizeof(FreeNode) ? sizeof(T) : sizeof(FreeNode)];
+        FreeNode* next;
+    };
+
+    void grow() {
+        chunks_.push_back(std::unique_ptr<Cell[]>(new Cell[ChunkSize]));
+        Cell* chunk = chunks_.back().get();
+        for (size_t i = ChunkSize; i-- > 0;) {
+            freeList_ = ::new (static_cast<void*>(&chunk[i])) FreeNode{freeList_};
+        }
+    }
+
+    std::vector<std::unique_ptr<Cell[]>> chunks_;
+    FreeNode* freeList_ = nullptr;
+    size_t live_ = 0;
+};
+
+} // namespace jts
+
+#endif
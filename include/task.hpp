@@ -21,9 +21,14 @@
 #include <vector>      // std::vector için - dinamik boyutlu dizi
 #include <cstdint>     // uint64_t için - 64-bit tamsayı türü
 #include <functional>  // std::function için - fonksiyon nesnesi sarmalayıcı
+#include <chrono>      // std::chrono için - periyot, son tarih, zaman damgası
+#include "inline_function.hpp"  // TaskFunction - allocation'sız iş fonksiyonu
+#include "timing_wheel.hpp"     // TimerLink - bekleme tekerleğine gömülü bağlantı
 
 namespace jts {  // jts = Jetson Task Scheduler, tüm kodlar bu ad alanında
 
+class Topology;  // topology.hpp - isValid() çekirdek kontrolü için
+
 /**
  * ----------------------------------------------------------------------------
  * TaskType enum - Görev Türleri
@@ -74,6 +79,28 @@ inline const char* taskTypeToString(TaskType type) {
  * - realtime: Gerçek zamanlı çalışma gereksinimi
  * - cpu_cores: Görevin sabitlenmesi gereken CPU çekirdekleri
  * - work: Görev çalıştırıldığında yürütülecek fonksiyon
+ *
+ * PERİYODİK GÖREVLER (EDF):
+ * - period: 0 ise tek seferlik; >0 ise her periyotta yeniden çalışır
+ *   (örn: 1 kHz sensör için 1000us). Görev çalıştıktan sonra silinmez,
+ *   registry'de aynı ID ile yeniden kurulur (kopya/allocation yok)
+ * - deadline: Aktivasyondan itibaren göreli son tarih (0 = period)
+ * - phase: İlk aktivasyon için gecikme
+ * - Aynı realtime/priority bandındaki hazır görevler mutlak son tarihe
+ *   göre sıralanır (Earliest Deadline First)
+ * - wcet: Aktivasyon başına tahmini en kötü çalışma süresi (bütçe,
+ *   0 = bilinmiyor). Kabul kontrolü açıksa periyodik görevin wcet/period
+ *   payı çekirdeğin kapasitesine göre sınanır; çalıştıktan sonra ölçülen
+ *   süre wcet'i aşarsa bütçe aşımı sayılır
+ *
+ * ÇALIŞMA ZAMANI ALANLARI (Scheduler tarafından doldurulur):
+ * - release_time: Mevcut aktivasyonun planlanan başlangıç anı
+ * - activations / deadline_misses: Çalışma ve son tarih kaçırma sayısı
+ * - budget_overruns / max_runtime: wcet'i aşan aktivasyon sayısı ve
+ *   ölçülen en uzun çalışma süresi
+ *
+ * Task sadece bir tanımdır: registry onu kayıtta bir kez ScheduledTask'a
+ * çevirir (aşağıya bakın), zamanlama yolunda Task kopyalanmaz.
  */
 struct Task {
     uint64_t id;            // Görev benzersiz kimliği (0'dan büyük)
@@ -84,6 +111,17 @@ struct Task {
     std::vector<int> cpu_cores;  // Sabitlenecek çekirdek numaraları
     std::function<void()> work;  // Çalıştırılacak iş fonksiyonu
 
+    std::chrono::microseconds period;    // Periyot (0 = tek seferlik)
+    std::chrono::microseconds deadline;  // Göreli son tarih (0 = period)
+    std::chrono::microseconds phase;     // İlk aktivasyon gecikmesi
+    std::chrono::microseconds wcet;      // Tahmini en kötü çalışma süresi (0 = bilinmiyor)
+
+    std::chrono::steady_clock::time_point release_time;  // Aktivasyon anı
+    uint64_t activations;       // Kaç kez çalıştı
+    uint64_t deadline_misses;   // Kaç kez son tarihi kaçırdı
+    uint64_t budget_overruns;   // Kaç kez wcet'ten uzun sürdü
+    std::chrono::microseconds max_runtime;  // Ölçülen en uzun aktivasyon
+
     // Yapıcı fonksiyonlar (Constructor)
     Task();  // Varsayılan yapıcı - boş görev oluşturur
     Task(uint64_t id, const std::string& name, TaskType type, int priority);
@@ -91,7 +129,148 @@ struct Task {
     // Üye fonksiyonlar (Methods)
     std::string serialize() const;  // JSON formatında çıktı üret
     std::string summary() const;    // Özet bilgi metni üret
-    bool isValid() const;           // Görev verilerinin geçerliliğini kontrol et
+    bool isValid() const;           // Görev verilerinin geçerliliğini kontrol et (canlı sistem)
+    bool isValid(const Topology& topology) const;  // Verilen topolojiye göre kontrol
+    bool isPeriodic() const { return period.count() > 0; }
+
+    // Tek seferlik kopya: period/phase/wcet sıfır (devam görevleri, graf
+    // düğümleri: bir kez ve hemen çalışmalı, kabul payı ayırmamalı)
+    Task oneShot() const {
+        Task t = *this;
+        t.period = t.phase = t.wcet = std::chrono::microseconds(0);
+        return t;
+    }
+
+    // Mutlak son tarih (son tarihi yoksa time_point::max())
+    std::chrono::steady_clock::time_point absoluteDeadline() const;
+};
+
+/**
+ * ----------------------------------------------------------------------------
+ * TaskFunction - Allocation'sız İş Fonksiyonu
+ * ----------------------------------------------------------------------------
+ * 64 bayta kadar yakalaması olan lambda'lar nesnenin içinde saklanır
+ * (std::function'ın aksine heap kullanılmaz). Sadece taşınabilir.
+ */
+using TaskFunction = InlineFunction<void(), 64>;
+
+/**
+ * ----------------------------------------------------------------------------
+ * CpuMask - Çekirdek Bit Maskesi
+ * ----------------------------------------------------------------------------
+ * cpu_cores vektörünün zamanlama yolunda kullanılan karşılığı.
+ * Her bit bir çekirdektir (en fazla 64); "çekirdek bu kümede mi?" sorusu
+ * tek bir bit işlemidir ve kopyalamak allocation gerektirmez.
+ * Boş maske = tüm çekirdekler (cpu_cores boş listesi gibi).
+ */
+class CpuMask {
+public:
+    static constexpr int kMaxCores = 64;
+
+    CpuMask() = default;
+    explicit CpuMask(uint64_t bits) : bits_(bits) {}
+
+    // Aralık dışındaki çekirdek numaraları yok sayılır; bu yüzden kayıt
+    // öncesi representable() ile kontrol edilir (yalnız çekirdek 70 boş
+    // maskeye, yani "tüm çekirdekler"e dönüşmesin)
+    static CpuMask fromCores(const std::vector<int>& cores);
+    static bool representable(const std::vector<int>& cores) {
+        for (int core : cores) {
+            if (core < 0 || core >= kMaxCores) return false;
+        }
+        return true;
+    }
+    std::vector<int> toCores() const;
+
+    void set(int core) {
+        if (core >= 0 && core < kMaxCores) bits_ |= uint64_t(1) << core;
+    }
+    bool test(int core) const {
+        return core >= 0 && core < kMaxCores && (bits_ >> core) & 1;
+    }
+    bool empty() const { return bits_ == 0; }
+    int count() const { return __builtin_popcountll(bits_); }
+    uint64_t bits() const { return bits_; }
+
+private:
+    uint64_t bits_ = 0;
+};
+
+/**
+ * ----------------------------------------------------------------------------
+ * internTaskName() / taskName() - Görev Adı Tablosu
+ * ----------------------------------------------------------------------------
+ * Her farklı görev adı süreç boyunca bir kez saklanır ve küçük bir ID alır.
+ * Aynı adla tekrar kaydedilen görevler için string kopyalanmaz.
+ * taskName() dönen işaretçi program sonuna kadar geçerlidir.
+ */
+uint32_t internTaskName(const std::string& name);
+const char* taskName(uint32_t nameId);
+
+/**
+ * ----------------------------------------------------------------------------
+ * ScheduledTask - Zamanlayıcı İçindeki Görev
+ * ----------------------------------------------------------------------------
+ * Task kullanıcıya dönük, kopyalanabilir tanımdır. Kayıt sırasında bir kez
+ * ScheduledTask'a çevrilir ve TaskRegistry'nin nesne havuzunda (SlabPool)
+ * yaşar; zamanlayıcı bundan sonra sadece işaretçi taşır.
+ *
+ * FARKLAR:
+ * - name yerine name_id (+ kararlı const char* ad)
+ * - cpu_cores yerine CpuMask
+ * - std::function yerine TaskFunction (satır içi saklama)
+ * - Kopyalanamaz; kararlı durumda oluşturma/çalıştırma/yeniden kurma
+ *   hiçbir heap allocation yapmaz
+ * - Aktivasyon beklerken registry'nin zamanlama tekerleğine kendi
+ *   gömülü bağlantısıyla (TimerLink) takılır; ayrı düğüm yoktur
+ */
+struct ScheduledTask : private TimerLink {
+    uint64_t id = 0;
+    uint32_t name_id = 0;
+    const char* name = "";      // taskName(name_id)
+    TaskType type = TaskType::CPU;
+    int priority = 5;
+    bool realtime = false;
+    CpuMask cores;
+    TaskFunction work;
+
+    std::chrono::microseconds period{0};
+    std::chrono::microseconds deadline{0};
+    std::chrono::microseconds phase{0};
+    std::chrono::microseconds wcet{0};
+
+    std::chrono::steady_clock::time_point release_time{};
+    uint64_t activations = 0;
+    uint64_t deadline_misses = 0;
+    uint64_t budget_overruns = 0;
+    std::chrono::microseconds max_runtime{0};
+
+    /**
+     * Task tanımından oluştur. work boşsa task.work (std::function)
+     * sarmalanır; std::function 32 bayt olduğundan o da satır içine sığar.
+     */
+    ScheduledTask(Task&& task, TaskFunction work);
+
+    ScheduledTask(const ScheduledTask&) = delete;
+    ScheduledTask& operator=(const ScheduledTask&) = delete;
+
+    bool isPeriodic() const { return period.count() > 0; }
+    std::chrono::steady_clock::time_point absoluteDeadline() const;
+
+    /**
+     * toTask() - Kullanıcıya Dönük Kopya
+     * İş fonksiyonu hariç tüm alanlar kopyalanır (TaskFunction
+     * kopyalanamaz); getTask() / listTasks() için kullanılır.
+     */
+    Task toTask() const;
+
+private:
+    friend class TaskRegistry;
+
+    // Registry'nin durumu (registry kilidi altında değişir)
+    enum class State : uint8_t { Ready, Waiting, Running, Cancelled };
+    State state_ = State::Ready;
+    size_t heapPos_ = 0;  // heap_ içindeki konum (bekleyenler tekerlekte, TimerLink)
 };
 
 } // namespace jts
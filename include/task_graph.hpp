@@ -0,0 +1,104 @@
+#ifndef TASK_GRAPH_HPP
+#define TASK_GRAPH_HPP
+
+#include "task.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace jts {
+
+class ThreadPool;
+class Scheduler;
+
+// Görev bağımlılık grafiği (DAG)
+// - addNode() ile düğümler, addEdge(a, b) ile "b, a bitince çalışır" kenarları
+// - Her düğümün atomik bir bekleyen-öncül sayacı vardır; son öncül bitince
+//   düğüm hemen çalıştırıcıya (ThreadPool veya Scheduler) verilir, bağımsız
+//   dallar paralel çalışır
+// - Graf bir kez kurulur, her karede run() ile tekrar çalıştırılır
+//   (sayaçlar her çalıştırmada sıfırlanır, yeniden kurulum yok)
+// - Döngü oluşturacak kenar reddedilir; graf her zaman DAG'dir
+//
+// Örnek (kamera -> çıkarım -> {takip, log} -> karar):
+//   TaskGraph g;
+//   auto cam = g.addNode("camera", [] { ... });
+//   auto ai  = g.addNode("inference", [] { ... });
+//   g.addEdge(cam, ai);
+//   ...
+//   for (;;) g.run(pool);  // Her kare
+class TaskGraph {
+public:
+    using NodeId = size_t;
+
+    TaskGraph() = default;
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    // desc'in adı, önceliği, realtime ve cpu_cores alanları Scheduler ile
+    // çalıştırırken her aktivasyonda kullanılır (ThreadPool sadece önceliği
+    // ve realtime'ı şerit seçiminde kullanır). Düğüm her çalıştırmada tek
+    // seferlik görevdir: period/phase/wcet yok sayılır
+    NodeId addNode(Task desc, TaskFunction work);
+    NodeId addNode(const std::string& name, TaskFunction work);
+
+    // to, from bitince çalışır. Geçersiz düğüm, tekrar eden kenar veya
+    // döngü oluşturacaksa false
+    bool addEdge(NodeId from, NodeId to);
+
+    // Tüm düğümleri bağımlılık sırasına uyarak çalıştır ve bitmesini bekle.
+    // Scheduler çalışmıyorsa (start() edilmemişse) görevler bu thread'de
+    // runOnce() ile yürütülür. Graf zaten çalışıyorsa false.
+    // Bir düğüm istisna fırlatırsa ya da Scheduler düğümü kabul etmezse
+    // (ör. cpu_cores aralık dışı) ardılları yine de çalışır, çalıştırma
+    // tamamlanır ve ilk hata burada yeniden fırlatılır
+    bool run(ThreadPool& pool);
+    bool run(Scheduler& scheduler);
+
+    size_t size() const { return nodes_.size(); }
+    const std::string& name(NodeId id) const { return nodes_[id]->desc.name; }
+    uint64_t runs() const { return runs_.load(std::memory_order_relaxed); }
+
+private:
+    struct Node {
+        Task desc;
+        TaskFunction work;
+        std::vector<NodeId> successors;
+        int predecessors = 0;
+        std::atomic<int> pending{0};  // Bu çalıştırmada bitmemiş öncül sayısı
+    };
+
+    bool reachable(NodeId from, NodeId to) const;
+
+    // Sayaçları sıfırla, kökleri dispatch_'e ver, bitişi bekle
+    bool execute(const std::function<void(NodeId)>& dispatch,
+                 const std::function<bool()>& driveInline = nullptr);
+
+    // Düğümü çalıştır ve serbest kalan ardılları dağıt
+    void runNode(NodeId id);
+    // Zamanlanamayan düğüm: hatayı kaydet, çalıştırmadan bitmiş say
+    void failNode(NodeId id);
+    void finishNode(NodeId id);
+
+    std::vector<std::unique_ptr<Node>> nodes_;
+
+    const std::function<void(NodeId)>* dispatch_ = nullptr;  // run() süresince geçerli
+    std::atomic<size_t> remaining_{0};
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> runs_{0};
+
+    std::mutex doneMutex_;
+    std::condition_variable doneCv_;
+    bool done_ = false;
+    std::exception_ptr error_;  // Bu çalıştırmadaki ilk düğüm istisnası (doneMutex_)
+};
+
+} // namespace jts
+
+#endif
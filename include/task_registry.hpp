@@ -10,6 +10,17 @@
  * - Her görev benzersiz bir ID alır (otomatik artan)
  * - Thread-safe (iş parçacığı güvenli) tasarım: mutex ile korunur
  * - CRUD işlemleri: Create (ekle), Read (oku), Update, Delete (sil)
+ * - Hazır görevler (realtime, priority, mutlak son tarih, FIFO sırası)
+ *   paketlenmiş 64-bit anahtarlı 4'lü bir heap'te tutulur; anahtarlar
+ *   görevlerden ayrı, sıkı bir dizidedir. En yüksek öncelikli görevi
+ *   seçip silmek O(log n)'dir
+ * - Aktivasyon anı gelmemiş görevler (periyodik / fazlı) ayrı bir
+ *   zaman heap'inde bekler, zamanı gelince hazır heap'e geçer
+ * - id -> görev hash indeksi: getTask O(1), removeTask O(log n)
+ * - Görevler kayıtta ScheduledTask'a çevrilip bir nesne havuzunda (SlabPool)
+ *   tutulur; zamanlayıcı acquireNext()/complete() ile sadece işaretçi alır
+ *   ve geri verir. Kararlı durumda kayıt, seçim ve yeniden kurma hiçbir
+ *   heap allocation yapmaz (kapasite reserve() ile önceden ayrılabilir)
  * 
  * NEDEN TEKİL KAYIT (Registry)?
  * - Görevleri merkezi yönetim sağlar
@@ -22,12 +33,29 @@
 #define TASK_REGISTRY_HPP
 
 #include "task.hpp"    // Task yapısı için
+#include "slab_pool.hpp" // SlabPool - ScheduledTask nesne havuzu
+#include "timing_wheel.hpp" // TimingWheel - aktivasyon bekleyen görevler
 #include <vector>      // std::vector - görev listesi için
 #include <mutex>       // std::mutex - iş parçacığı senkronizasyonu için
 #include <optional>    // std::optional - var/yok durumu için (C++17)
+#include <chrono>      // Aktivasyon zamanları için
+#include <functional>  // std::function - çıkış bildirimi için
 
 namespace jts {
 
+/**
+ * ----------------------------------------------------------------------------
+ * ActivationResult - Bir Aktivasyonun Ölçümleri
+ * ----------------------------------------------------------------------------
+ * Worker ölçer, complete() registry kilidi altında görevin sayaçlarına
+ * işler: getTask() görev çalışırken de tutarlı bir kopya okur.
+ */
+struct ActivationResult {
+    std::chrono::microseconds runtime{0};  // work süresi (work yoksa 0)
+    bool missed = false;                   // Son tarih kaçırıldı
+    bool overrun = false;                  // wcet aşıldı
+};
+
 /**
  * ----------------------------------------------------------------------------
  * TaskRegistry sınıfı - Görev Kayıt Defteri
@@ -43,18 +71,38 @@ namespace jts {
  */
 class TaskRegistry {
 public:
+    using Clock = std::chrono::steady_clock;
+
+    TaskRegistry();
+    ~TaskRegistry();
+
+    TaskRegistry(const TaskRegistry&) = delete;
+    TaskRegistry& operator=(const TaskRegistry&) = delete;
+
     /**
      * registerTask() - Yeni Görev Kaydet
      * Görevi listeye ekler ve otomatik bir ID atar.
+     * task.release_time gelecekteyse görev o ana kadar zamanlama tekerleğinde kalır.
      * @param task Kaydedilecek görev
-     * @return Atanan benzersiz görev ID'si
+     * @param work Verilirse task.work yerine kullanılır (std::function yok)
+     * @return Atanan benzersiz görev ID'si; cpu_cores CpuMask aralığı
+     *         dışında (< 0 ya da >= 64) çekirdek içeriyorsa 0 (kaydedilmez)
      */
     uint64_t registerTask(Task task);
+    uint64_t registerTask(Task task, TaskFunction work);
+
+    /**
+     * registerTasks() - Toplu Kayıt
+     * Tüm görevleri tek kilit altında ekler (görev başına kilit yok).
+     * @param tasks Kaydedilecek görevler
+     * @return Atanan ID'ler, tasks ile aynı sırada (reddedilenler 0)
+     */
+    std::vector<uint64_t> registerTasks(std::vector<Task> tasks);
     
     /**
      * getTask() - ID ile Görev Getir
      * @param id Aranan görevin ID'si
-     * @return Bulunan görev veya boş (std::nullopt)
+     * @return Bulunan görevin kopyası (work hariç) veya boş (std::nullopt)
      * 
      * std::optional kullanımı: Görev bulunamazsa nullptr yerine
      * güvenli bir "boş" değer döner
@@ -63,9 +111,70 @@ public:
     
     /**
      * listTasks() - Tüm Görevleri Listele
-     * @return Kayıtlı tüm görevlerin kopyası
+     * @return Kayıtlı tüm görevlerin kopyası (kayıt sırasına göre, work hariç)
      */
     std::vector<Task> listTasks() const;
+
+    /**
+     * popHighest() - En Yüksek Öncelikli Görevi Al ve Sil
+     * Önce aktivasyon anı gelmiş görevleri hazır heap'e taşır.
+     * Seçme ve silme tek kilit altında, atomik olarak yapılır.
+     * Sıralama: önce realtime, sonra priority, sonra en erken mutlak son
+     * tarih (EDF), eşitlikte ilk gelen (FIFO).
+     * Görev (periyodik olsa bile) registry'den tamamen çıkar; iş fonksiyonu
+     * std::function'a köprülenir (allocation yapar). Zamanlayıcı bunun
+     * yerine acquireNext() kullanır.
+     * @return Çıkarılan görev veya boş (hazır görev yoksa)
+     */
+    std::optional<Task> popHighest();
+
+    /**
+     * acquireNext() - Sıradaki Görevi Ödünç Al
+     * popHighest() ile aynı seçim, ama görev havuzda kalır ve çağırana
+     * işaretçi olarak verilir (kopya/taşıma yok). Çağıran işi bitince
+     * görevi mutlaka complete() ile geri vermelidir.
+     * Görev "çalışıyor" olarak işaretlenir ve complete()'e kadar
+     * getTask()/contains() ile bulunabilir; periyodik görevler bu sırada
+     * removeTask() ile iptal edilebilir.
+     * @return Görev veya nullptr (hazır görev yoksa)
+     */
+    ScheduledTask* acquireNext();
+
+    /**
+     * complete() - Ödünç Alınan Görevi Geri Ver
+     * Önce result görevin sayaçlarına (activations, deadline_misses,
+     * budget_overruns, max_runtime) işlenir. Tek seferlik görev havuza
+     * döner. Periyodik görev release_time + period anına, aynı ID ile
+     * zamanlama tekerleğine geri konur; çalışırken iptal edildiyse havuza
+     * döner. Hepsi kilit altında: çalışan görevin alanlarını worker yazmaz.
+     * @return true: periyodik görev yeniden kuruldu
+     */
+    bool complete(ScheduledTask* task, const ActivationResult& result = ActivationResult());
+
+    /**
+     * nextRelease() - En Yakın Aktivasyon Anı
+     * Tekerlek üst seviyelerde yuva başlangıcını verir: dönen an en erken
+     * aktivasyondan geç değildir, ama erken olabilir (o anda releaseDue()
+     * görevleri alt seviyelere indirir ve yeni anı verir).
+     * @return Bekleyen görevler için bir sonraki uyanma anı (yoksa boş)
+     */
+    std::optional<Clock::time_point> nextRelease() const;
+
+    /**
+     * releaseDue() - Zamanı Gelenleri Hazırla
+     * Aktivasyon anı gelmiş görevleri tekerlekten hazır heap'e taşır.
+     * acquireNext() bunu zaten yapar; Scheduler'ın zamanlayıcı thread'i
+     * uyandığında worker'ları ancak gerçekten hazır görev varsa uyandırmak
+     * için kullanır.
+     * @return Hazır heap'e taşınan görev sayısı
+     */
+    size_t releaseDue();
+
+    /**
+     * readyCount() - Hazır Görev Sayısı
+     * @return Hemen çalıştırılabilecek görev adedi (bekleyenler hariç)
+     */
+    size_t readyCount() const;
     
     /**
      * removeTask() - Görevi Sil
@@ -76,21 +185,141 @@ public:
     
     /**
      * count() - Görev Sayısını Döndür
-     * @return Kayıtlı görev adedi
+     * @return Kayıtlı görev adedi (hazır + aktivasyon bekleyen)
      */
     size_t count() const;
+
+    /**
+     * contains() - Görev Bitmedi mi?
+     * @return true: görev kayıtlı, çalışıyor veya ödünç alınmış durumda;
+     *         false: tamamlandı, iptal edildi ya da hiç yoktu
+     */
+    bool contains(uint64_t id) const;
+
+    /**
+     * activeCount() - Bitmemiş Görev Sayısı
+     * @return count() + ödünç alınmış (çalışan) görevler
+     */
+    size_t activeCount() const;
     
     /**
      * clear() - Tüm Görevleri Temizle
-     * Listeyi tamamen boşaltır
+     * Listeyi tamamen boşaltır. O an çalışan (ödünç alınmış) görevler
+     * iptal edilir, complete() ile döndüklerinde serbest bırakılır.
      */
     void clear();
 
+    /**
+     * reserve() - Kapasite Ayır
+     * count adet eşzamanlı görev için havuz, heap ve indeks kapasitesini
+     * önceden ayırır; sonrasındaki kayıtlar allocation yapmaz.
+     */
+    void reserve(size_t count);
+
+    /**
+     * setReleaseHook() - Bütçeli Görev Çıkış Bildirimi
+     * Bütçeli periyodik görev (wcet > 0) registry'den kalıcı olarak
+     * çıktığında (removeTask(), clear(), popHighest(), çalışırken iptal
+     * edilip complete() ile dönüş) id ile çağrılır. Scheduler kabul
+     * kontrolü payını bununla geri verir; kim silerse silsin pay sızmaz.
+     * Registry kilidi altında çalışır: hook registry'yi çağırmamalıdır.
+     * Diğer görevlerde çağrılmaz (sıcak yolda maliyet yok).
+     */
+    using ReleaseHook = std::function<void(uint64_t id)>;
+    void setReleaseHook(ReleaseHook hook);
+
 private:
     // Özel üye değişkenler (dışarıdan erişilemez)
-    
-    std::vector<Task> tasks_;  // Görev listesi (dinamik dizi)
-    
+
+    /**
+     * HeapEntry - Hazır Heap Anahtarı (sıcak dizi)
+     * Seçimde okunan her şey 16 bayta sığar: paketlenmiş 64-bit sıralama
+     * anahtarı + FIFO sırası. Görev işaretçileri aynı konumda ayrı bir
+     * dizide (heapTasks_) durur; kaydırma sırasındaki karşılaştırmalar
+     * sadece bu sıkı diziye dokunur (cache satırı başına 4 anahtar).
+     *
+     * key bit düzeni (küçük değer önce çalışır, tek tamsayı karşılaştırması):
+     *   [63]    realtime değil (realtime görevler 0, yani önce)
+     *   [62:48] ters çevrilmiş priority ([-16384, 16383] aralığına kırpılır)
+     *   [47:0]  mutlak son tarih, mikrosaniye (EDF; son tarihi yoksa doymuş)
+     */
+    struct HeapEntry {
+        uint64_t key;
+        uint64_t seq;     // Eşit anahtarda kayıt sırası (FIFO)
+    };
+    static uint64_t packKey(bool realtime, int priority, int64_t deadlineNs);
+
+    // 4'lü heap: derinlik log4(n); bir düğümün 4 çocuğu bitişik (64 bayt)
+    // ve en iyisi tek geçişlik basit bir döngüyle seçilir
+    static constexpr size_t kArity = 4;
+
+    /**
+     * IdIndex - id -> Görev Hash Tablosu
+     * Açık adresleme (doğrusal sondalama, geri kaydırmalı silme) ile düz bir
+     * dizi; std::unordered_map'in aksine ekleme başına düğüm allocation'ı
+     * yoktur. id 0 boş hücre demektir (ID'ler 1'den başlar).
+     */
+    class IdIndex {
+    public:
+        ScheduledTask* find(uint64_t id) const;
+        void insert(uint64_t id, ScheduledTask* task);
+        bool erase(uint64_t id);
+        void reserve(size_t count);
+        void clear();
+        size_t size() const { return size_; }
+
+        template <typename F>
+        void forEach(F&& f) const {
+            for (const auto& e : table_) {
+                if (e.id != 0) f(e.task);
+            }
+        }
+
+    private:
+        struct Entry {
+            uint64_t id;
+            ScheduledTask* task;
+        };
+
+        size_t home(uint64_t id) const;
+        void rehash(size_t capacity);
+
+        std::vector<Entry> table_;  // Boyut 2'nin kuvveti
+        size_t size_ = 0;
+    };
+
+    // a, b'den önce çalışmalı mı?
+    static bool higher(const HeapEntry& a, const HeapEntry& b);
+
+    static int64_t toNs(Clock::time_point t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            t.time_since_epoch()).count();
+    }
+
+    // Heap yardımcıları (mutex_ kilitliyken çağrılır)
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+    void swapEntries(size_t a, size_t b);
+    ScheduledTask* eraseAt(size_t pos);  // heap_[pos]'u sil (görev havuzda kalır)
+
+    // Tekerlek tick'i 1 us; aktivasyon yukarı yuvarlanır (hiç erken değil)
+    static int64_t toTick(int64_t ns) { return ns / 1000 + (ns % 1000 > 0 ? 1 : 0); }
+    static TimerLink* linkOf(ScheduledTask* task) { return task; }
+    static ScheduledTask* taskOf(TimerLink* link) { return static_cast<ScheduledTask*>(link); }
+
+    void pushReady(ScheduledTask* task);  // Görevi hazır heap'e koy
+    void insert(ScheduledTask* task, int64_t now);  // Hazır heap'e veya tekerleğe koy
+    size_t promoteDue(int64_t now);  // Zamanı gelenleri hazır heap'e taşı
+    ScheduledTask* takeNext();       // Kökü çıkar, Running olarak işaretle
+    void release(ScheduledTask* task);  // Görevi havuza geri ver
+
+    SlabPool<ScheduledTask> pool_;    // Görev deposu (kararlı adresler)
+    std::vector<HeapEntry> heap_;     // 4'lü heap anahtarları (en yüksek öncelik kökte)
+    std::vector<ScheduledTask*> heapTasks_;  // heap_[i]'nin görevi (soğuk dizi)
+    TimingWheel wheel_;               // Aktivasyon bekleyenler (O(1) ekleme/iptal)
+    IdIndex index_;                   // id -> görev (hazır, bekleyen, çalışan periyodik)
+    ReleaseHook releaseHook_;         // Bütçeli görev çıkışı (mutex_ altında)
+
     /**
      * mutex_ - Karşılıklı Dışlama Kilidi
      * Birden fazla thread aynı anda listeye eriştiğinde veri bozulmasını önler.
@@ -99,6 +328,7 @@ private:
     mutable std::mutex mutex_;
     
     uint64_t nextId_ = 1;  // Bir sonraki atanacak ID (1'den başlar)
+    uint64_t nextSeq_ = 0; // FIFO sıra sayacı
 };
 
 } // namespace jts
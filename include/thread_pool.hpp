@@ -8,36 +8,203 @@
 #include <condition_variable>
 #include <functional>
 #include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "future.hpp"
 
 namespace jts {
 
+// Havuz boyutu ve boşta bekleme davranışı
+struct PoolOptions {
+    size_t minThreads = 0;  // Her zaman açık worker (0 = CPU sayısı)
+    size_t maxThreads = 0;  // Kuyruk birikince büyüme sınırı (0 = minThreads, sabit boyut)
+    // İş kalmayınca park etmeden (futex) önce dönme süresi: gecikmeye duyarlı
+    // havuzlarda ani işler uyandırma beklemeden alınır; 0 = hemen park (güç tasarrufu)
+    std::chrono::microseconds spin{0};
+    // minThreads üstündeki worker bu kadar boşta kalırsa kapanır
+    std::chrono::milliseconds idleTimeout{1000};
+    std::chrono::microseconds agingStep{10000};  // 0 = katı öncelik
+};
+
+// Öncelik şeritli thread havuzu
+// - Her öncelik (0-10, Task::priority ile aynı anlam) için bir FIFO şerit ve
+//   en üstte bir realtime şeridi. Worker'lar en yüksek dolu şeritten alır;
+//   realtime şeridi her zaman önce.
+// - Yaşlanma: kuyrukta bekleyen iş her agingStep'te bir seviye yükselmiş
+//   sayılır (en fazla 10; realtime'ı hiç geçmez). Eşit seviyede eski iş önce
+//   alınır, böylece düşük şeritler sonsuza kadar aç kalmaz. agingStep 0:
+//   katı öncelik.
+// - Esnek boyut: worker sayısı [minThreads, maxThreads] aralığında. Yeni iş
+//   geldiğinde boşta (dönen, park etmiş veya başlamakta olan) worker yoksa
+//   bir worker eklenir; minThreads üstündekiler idleTimeout boşta kalınca çıkar.
+// - Boşta bekleme: önce spin süresi kadar kuyruk sayacı izlenir (yarısı
+//   pause, yarısı yield), sonra condition variable'da park edilir. Dönen
+//   worker işi alacaksa ekleyen taraf futex uyandırması yapmaz.
+// - Worker'lar Topology cache gruplarına dağıtılır (tüm CPU'lar tek
+//   grupsa sabitleme yapılmaz).
 class ThreadPool {
 public:
-    explicit ThreadPool(size_t numThreads = 0);  // 0 = CPU sayısı kadar
+    static constexpr int kMaxPriority = 10;
+    static constexpr int kDefaultPriority = 5;  // Task varsayılanı
+    static constexpr size_t kLanes = kMaxPriority + 2;  // 0..10 + realtime
+
+    // numThreads 0 = CPU sayısı kadar (sabit boyut, spin yok)
+    explicit ThreadPool(size_t numThreads = 0,
+                        std::chrono::microseconds agingStep = std::chrono::milliseconds(10));
+    explicit ThreadPool(const PoolOptions& options);
     ~ThreadPool();
 
-    // İş ekle
-    void submit(std::function<void()> job);
+    // İş ekle; dönüş değeri veya fırlatılan istisna Future'a yazılır
+    // (sonuç gerekmiyorsa Future yok sayılabilir). Öncelik verilmezse
+    // kDefaultPriority; 0-10 dışı değerler sınıra çekilir.
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>&>>
+    Future<R> submit(F&& fn) {
+        return submit(kDefaultPriority, false, std::forward<F>(fn));
+    }
+
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>&>>
+    Future<R> submit(int priority, F&& fn) {
+        return submit(priority, false, std::forward<F>(fn));
+    }
+
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>&>>
+    Future<R> submit(int priority, bool realtime, F&& fn) {
+        Promise<R> promise;
+        Future<R> future = promise.getFuture();
+        enqueue(laneOf(priority, realtime),
+                [promise, fn = std::forward<F>(fn)]() mutable { promise.fulfill(fn); });
+        return future;
+    }
 
-    // Havuz boyutu
-    size_t size() const { return workers_.size(); }
+    // Birden çok işi aynı şeride tek kilit ve tek bildirimle ekle (iş başına
+    // Future yok; bitişi waitIdle() ile beklenir). Fırlatan iş loglanır,
+    // diğer işler ve worker etkilenmez
+    void submitBulk(std::vector<std::function<void()>> jobs,
+                    int priority = kDefaultPriority, bool realtime = false);
 
-    // Bekleyen iş sayısı
+    // [begin, end) aralığında fn(i)'yi grain'lik parçalar halinde paralel çalıştır
+    // - grain 0: otomatik (worker başına ~4 parça, yük dengesi için)
+    // - Parçalar ortak bir sayaçtan alınır; en fazla size() yardımcı iş eklenir
+    //   ve çağıran thread de parça işler (havuz içinden çağrılabilir)
+    // - Yardımcı işler çağıranın şeridine girer (havuz dışından: varsayılan)
+    // - Döndüğünde tüm parçalar bitmiştir; fn fırlattıysa ilk istisna burada
+    //   yeniden fırlatılır (kalan parçalar atlanır)
+    template <typename F>
+    void parallelFor(size_t begin, size_t end, size_t grain, F&& fn);
+
+    // Kuyruk boşalıp çalışan iş kalmayana kadar bekle (bariyer)
+    void waitIdle();
+
+    // Şu an açık worker sayısı (esnek havuzda değişir)
+    size_t size() const { return live_.load(std::memory_order_relaxed); }
+    size_t minThreads() const { return min_; }
+    size_t maxThreads() const { return max_; }
+
+    // Bekleyen iş sayısı: toplam veya tek şerit
     size_t pending() const;
+    size_t pending(int priority, bool realtime = false) const;
 
     // Durdur
     void shutdown();
 
 private:
-    std::vector<std::thread> workers_;
-    std::queue<std::function<void()>> jobs_;
-    std::mutex mutex_;
+    struct Job {
+        std::function<void()> fn;
+        std::chrono::steady_clock::time_point enqueued;  // Sadece yaşlanma açıkken
+    };
+
+    std::queue<Job> lanes_[kLanes];
+    std::atomic<size_t> queued_{0};  // Tüm şeritlerdeki iş (mutex_ altında yazılır, spin okur)
+    const std::chrono::steady_clock::duration agingStep_;
+    const std::chrono::microseconds spin_;
+    const std::chrono::milliseconds idleTimeout_;
+    size_t min_ = 0;
+    size_t max_ = 0;
+    mutable std::mutex mutex_;
     std::condition_variable condition_;
+    std::condition_variable idleCv_;
+    size_t active_ = 0;    // Çalışmakta olan iş (mutex_ altında)
+    size_t spinning_ = 0;  // Spin eden worker (mutex_ altında)
+    size_t parked_ = 0;    // condition_'da bekleyen worker (mutex_ altında)
+    size_t starting_ = 0;  // Başlatılmış ama döngüye girmemiş worker (mutex_ altında)
+    std::atomic<size_t> live_{0};  // Açık worker (mutex_ altında yazılır)
     std::atomic<bool> stop_{false};
 
-    void workerLoop();
+    // Worker thread'leri: yuvalar sadece growMutex_ altında eklenir/değişir.
+    // Çıkan worker yuvasını exited_'e koyar; bir sonraki büyümede join edilip
+    // yeniden kullanılır.
+    std::mutex growMutex_;
+    std::vector<std::thread> workers_;
+    std::vector<size_t> exited_;  // mutex_ altında
+    std::vector<std::vector<int>> slotCpus_;  // Yuva başına affinity (boş: sabitleme yok)
+
+    static size_t laneOf(int priority, bool realtime);
+    static size_t callerLane();  // Bu thread'de çalışan havuz işinin şeridi
+
+    void enqueue(size_t lane, std::function<void()> job);
+    void enqueueBulk(size_t lane, std::vector<std::function<void()>> jobs);
+    size_t pickLane() const;  // mutex_ altında, queued_ > 0 iken
+    bool wantsWorker() const;  // mutex_ altında: yeni iş için boşta worker yok mu
+    void grow();
+    void startWorker(size_t slot);  // growMutex_ altında
+    void spinWait() const;
+    void workerLoop(size_t slot);
 };
 
+template <typename F>
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grain, F&& fn) {
+    if (begin >= end) return;
+    const size_t n = end - begin;
+    if (grain == 0) {
+        grain = std::max<size_t>(1, n / (std::max<size_t>(1, size()) * 4));
+    }
+    const size_t chunks = (n + grain - 1) / grain;
+
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> finished{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        detail::Completion done;
+    };
+    // Geç başlayan yardımcı işler dönüşten sonra da sayaca dokunabilir
+    auto state = std::make_shared<State>();
+    auto& body = fn;
+
+    // fn'e sadece parça alınabildiyse dokunulur: parçalar bitince body
+    // referansı bir daha kullanılmaz
+    auto drain = [state, chunks, begin, end, grain, &body]() {
+        size_t c;
+        while ((c = state->next.fetch_add(1, std::memory_order_relaxed)) < chunks) {
+            size_t lo = begin + c * grain;
+            size_t hi = std::min(end, lo + grain);
+            if (!state->failed.load(std::memory_order_relaxed)) {
+                try {
+                    for (size_t i = lo; i < hi; ++i) body(i);
+                } catch (...) {
+                    if (!state->failed.exchange(true)) state->error = std::current_exception();
+                }
+            }
+            if (state->finished.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks) {
+                state->done.set();
+            }
+        }
+    };
+
+    size_t helpers = std::min(chunks - 1, size());
+    if (helpers > 0) {
+        std::vector<std::function<void()>> jobs(helpers, drain);
+        enqueueBulk(callerLane(), std::move(jobs));
+    }
+    drain();
+    state->done.wait();
+    if (state->error) std::rethrow_exception(state->error);
+}
+
 } // namespace jts
 
 #endif
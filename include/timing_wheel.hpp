@@ -0,0 +1,124 @@
+#ifndef TIMING_WHEEL_HPP
+#define TIMING_WHEEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace jts {
+
+// Tekerlekte bekleyen öğenin gömülü bağlantısı (öğe bundan türer)
+struct TimerLink {
+    TimerLink* prev = nullptr;
+    TimerLink* next = nullptr;
+    int64_t when = 0;       // Sona erme anı (tick)
+    uint16_t bucket = 0;    // seviye * kSlots + yuva (bağlıyken)
+};
+
+// Hiyerarşik zamanlama tekerleği (tick: çağıranın birimi, registry'de 1 us)
+// - kLevels seviye x 64 yuva; seviye i'nin bir yuvası 64^i tick kapsar.
+//   Öğe, şimdiki an ile sona erme anının ilk farklı olduğu 6 bitlik gruba
+//   göre seviyeye konur (yakın olanlar ince, uzak olanlar kaba seviyede)
+// - insert / remove O(1): yuva başına çift yönlü gömülü liste, allocation yok
+// - Her seviyenin 64 bitlik doluluk maskesi vardır; bir sonraki dolu yuva
+//   döndürme + ctz ile bulunur, nextExpiry() O(kLevels)
+// - advance(): zamanı gelen yuvalar boşaltılır; üst seviyedekiler alt
+//   seviyelere iner (cascade), 0. seviyedekiler geri çağrıya verilir
+// - Ufuk 2^48 tick (1 us ile ~8.9 yıl); ötesi ufka kırpılır, sona erdiğinde
+//   gerçek anı gelmemişse yeniden yerleştirilir
+// - Thread güvenli değildir; sahibi kilitler
+class TimingWheel {
+public:
+    static constexpr int kSlotBits = 6;
+    static constexpr int kSlots = 1 << kSlotBits;  // 64
+    static constexpr int kLevels = 8;
+    static constexpr int64_t kHorizon = (int64_t(1) << (kSlotBits * kLevels)) - 1;
+
+    explicit TimingWheel(int64_t now = 0) : elapsed_(now) {}
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+
+    // when <= elapsed() ise false döner (öğe zaten süresi dolmuş, eklenmez)
+    bool insert(TimerLink* link, int64_t when);
+    void remove(TimerLink* link);
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+    int64_t elapsed() const { return elapsed_; }
+
+    // En erken işlenmesi gereken an; en erken öğenin anından büyük olmaz
+    // (üst seviyede yuva başlangıcıdır, advance() orada cascade yapar)
+    std::optional<int64_t> nextExpiry() const;
+
+    // now'a kadar ilerle; when <= now olan her öğe listeden çıkarılıp
+    // expired(TimerLink*) ile verilir. Verilen öğe sayısı döner.
+    template <typename F>
+    size_t advance(int64_t now, F&& expired);
+
+    // Tüm öğeleri (sırasız) gez; f öğeyi yok edebilir, tekerlek ardından
+    // clear() ile boşaltılmalıdır
+    template <typename F>
+    void forEach(F&& f) const;
+
+    void clear();
+
+private:
+    struct Expiry {
+        int level;
+        int slot;
+        int64_t deadline;
+    };
+
+    std::optional<Expiry> next() const;
+    TimerLink* take(int level, int slot);  // Yuvayı boşalt, listeyi döndür
+    void link(TimerLink* link);
+
+    TimerLink* slots_[kLevels][kSlots] = {};
+    uint64_t occupied_[kLevels] = {};
+    int64_t elapsed_;
+    size_t size_ = 0;
+};
+
+template <typename F>
+size_t TimingWheel::advance(int64_t now, F&& expired) {
+    size_t fired = 0;
+    while (true) {
+        std::optional<Expiry> e = next();
+        if (!e || e->deadline > now) break;
+        if (e->deadline > elapsed_) elapsed_ = e->deadline;
+
+        TimerLink* item = take(e->level, e->slot);
+        while (item) {
+            TimerLink* following = item->next;
+            item->prev = item->next = nullptr;
+            size_--;
+            if (item->when <= now) {
+                fired++;
+                expired(item);
+            } else {
+                link(item);  // Alt seviyeye in (elapsed_ ilerledi)
+            }
+            item = following;
+        }
+    }
+    if (now > elapsed_) elapsed_ = now;
+    return fired;
+}
+
+template <typename F>
+void TimingWheel::forEach(F&& f) const {
+    for (int level = 0; level < kLevels; ++level) {
+        for (int slot = 0; slot < kSlots; ++slot) {
+            for (TimerLink* item = slots_[level][slot]; item;) {
+                TimerLink* following = item->next;
+                f(item);
+                item = following;
+            }
+        }
+    }
+}
+
+} // namespace jts
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef TOPOLOGY_HPP
+#define TOPOLOGY_HPP
+
+#include <string>
+#include <vector>
+
+namespace jts {
+
+// Tek bir mantıksal CPU'nun konumu
+struct CpuInfo {
+    int id = 0;
+    int package = 0;       // physical_package_id
+    int cluster = 0;       // cluster_id (ARM küme); yoksa package
+    int core = 0;          // core_id (SMT kardeşleri aynı)
+    int node = 0;          // NUMA düğümü
+    int l2 = -1;           // L2'yi paylaşan CPU'ların en küçüğü (grup anahtarı)
+    int l3 = -1;           // L3 için aynısı (-1: yok)
+    int cacheGroup = 0;    // Birlikte yerleştirilecek grup (bkz. Topology)
+    bool isolated = false; // isolcpus ile genel zamanlamadan ayrılmış
+    bool allowed = true;   // Süreç affinity maskesinde (sadece canlı sistemde)
+};
+
+// CPU topolojisi (/sys/devices/system/cpu ve /sys/devices/system/node)
+// - Çevrimiçi CPU'lar, paket/küme/çekirdek kimlikleri, L2/L3 paylaşım
+//   grupları, izole CPU'lar ve NUMA düğümleri okunur
+// - Cache grubu: birden fazla CPU'nun paylaştığı en küçük cache (Jetson'da
+//   küme L2'si, tipik x86'da paket L3'ü); yoksa paket
+// - sysfs okunamazsa sysconf kadar CPU'lu düz bir topoloji varsayılır
+// - Kök dizin değiştirilebilir: testler sahte (fixture) ağaç kullanır
+class Topology {
+public:
+    // sysRoot altındaki devices/system/{cpu,node} okunur
+    static Topology discover(const std::string& sysRoot = "/sys");
+
+    // Canlı sistem; ilk çağrıda bir kez okunur, süreç affinity'si de uygulanır
+    static const Topology& system();
+
+    const std::vector<CpuInfo>& cpus() const { return cpus_; }  // id'ye göre sıralı
+    const CpuInfo* cpu(int id) const;
+
+    size_t size() const { return cpus_.size(); }  // Çevrimiçi CPU sayısı
+    bool online(int id) const { return cpu(id) != nullptr; }
+    bool isolated(int id) const;
+    size_t nodeCount() const { return nodeCount_; }
+
+    bool sameCacheGroup(int a, int b) const;
+
+    // Cache gruplarının CPU listeleri (grup sırasına göre)
+    std::vector<std::vector<int>> cacheGroups() const;
+
+    // n worker için çekirdek ataması: önce izole olmayan ve izinli CPU'lar,
+    // aynı düğüm/paket/cache grubundakiler art arda; sonra izole olanlar.
+    // n CPU sayısından büyükse baştan tekrarlanır.
+    std::vector<int> placement(size_t n) const;
+
+    // Bir CPU'nun cache grubundaki tüm CPU'lar (kendisi dahil)
+    std::vector<int> groupOf(int id) const;
+
+private:
+    std::vector<CpuInfo> cpus_;
+    size_t nodeCount_ = 1;
+
+    void finalize();
+};
+
+// "0-3,6,8-9" biçimindeki sysfs CPU listesini çöz (hatalı parçalar atlanır)
+std::vector<int> parseCpuList(const std::string& text);
+
+} // namespace jts
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace jts {
+
+// Zaman çizelgesi olayları
+enum class TraceEvent : uint8_t {
+    Enqueue,   // Görev kuyruğa eklendi
+    Dispatch,  // Görev bir worker'a verildi
+    Start,     // Çalışma başladı
+    End        // Çalışma bitti
+};
+
+// Scheduler / havuz zaman çizelgesi kaydedici
+// - enable() tamponu bir kez ayırır; kayıt yolu allocation ve kilit içermez
+//   (atomik indeks ayırma + sabit boyutlu kayıt)
+// - Kapalıyken maliyet tek bir relaxed atomik okuma ve dallanmadır
+// - JTS_DISABLE_TRACING ile derlenirse JTS_TRACE tamamen kaybolur
+// - exportChromeTrace(): chrome://tracing ve ui.perfetto.dev ile açılabilir JSON
+class Tracer {
+public:
+    static Tracer& instance();
+
+    // capacity: tutulacak en fazla olay (dolunca yeni olaylar sayılıp atılır)
+    // Tampon ilk çağrıda ayrılır; her çağrı yeni bir oturum başlatır (önceki
+    // olaylar ve dropped() silinir, dışa aktarım disable() sonrası yapılır).
+    // Çağrı sırasında kayıt yapan thread olmamalıdır
+    void enable(size_t capacity = 1 << 16);
+    void disable();
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    void record(TraceEvent event, uint64_t taskId, const char* name, int arg = -1);
+
+    // Chrome trace-event JSON formatında yaz
+    void exportChromeTrace(std::ostream& out) const;
+    bool exportChromeTrace(const std::string& path) const;
+
+    void clear();
+    size_t size() const;
+    uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+private:
+    Tracer() = default;
+
+    struct Entry {
+        std::atomic<bool> ready{false};  // Yazım tamamlandı mı
+        TraceEvent event;
+        int16_t cpu;
+        int32_t arg;       // Olaya özel (ör. Dispatch'te hedef çekirdek)
+        uint32_t tid;
+        int64_t ts_ns;
+        uint64_t task_id;
+        char name[24];     // Kısaltılmış görev adı (string kopyası yok)
+    };
+
+    std::atomic<bool> enabled_{false};
+    std::unique_ptr<Entry[]> entries_;
+    size_t capacity_ = 0;
+    std::atomic<size_t> next_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+} // namespace jts
+
+// JTS_TRACE(olay, id, ad) / JTS_TRACE_ARG(olay, id, ad, arg)
+#ifdef JTS_DISABLE_TRACING
+#define JTS_TRACE_ARG(event, taskId, name, arg) do {} while (0)
+#else
+#define JTS_TRACE_ARG(event, taskId, name, arg)                                \
+    do {                                                                       \
+        if (::jts::Tracer::instance().enabled()) {                             \
+            ::jts::Tracer::instance().record(event, taskId, name, arg);        \
+        }                                                                      \
+    } while (0)
+#endif
+
+#define JTS_TRACE(event, taskId, name) JTS_TRACE_ARG(event, taskId, name, -1)
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <memory>
+#include <random>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "future.hpp"
+
+namespace jts {
+
+// Chase–Lev iş çalma kuyruğu (Lê et al., 2013 bellek modeli)
+// Sahip thread alttan push/pop yapar (LIFO), diğerleri üstten çalar (FIFO).
+// Sahip tarafı kilitsizdir; çalma sadece bir CAS ile yarışır.
+class WorkStealingDeque {
+public:
+    using Job = std::function<void()>;
+
+    explicit WorkStealingDeque(int64_t capacity = 256);
+    ~WorkStealingDeque();
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    // Sadece sahip thread çağırabilir
+    void push(Job* job);
+    Job* pop();
+
+    // Herhangi bir thread çağırabilir; boşsa veya yarış kaybedilirse nullptr
+    Job* steal();
+
+    size_t size() const;
+
+private:
+    struct Array {
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<Job*>[]> slots;
+
+        explicit Array(int64_t cap);
+        Job* get(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void put(int64_t i, Job* job) { slots[i & mask].store(job, std::memory_order_relaxed); }
+    };
+
+    Array* grow(Array* old, int64_t bottom, int64_t top);
+
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    std::atomic<Array*> array_;
+    // Eski diziler, hâlâ okuyan bir hırsız olabileceği için yıkıcıya kadar tutulur
+    std::vector<std::unique_ptr<Array>> retired_;
+};
+
+// İş çalan thread havuzu: ThreadPool ile aynı API (submit/waitIdle/size/pending/shutdown)
+// - Her worker'ın kendi Chase–Lev kuyruğu var, havuz içinden submit buraya gider
+// - Havuz dışından submit global enjeksiyon kuyruğuna gider
+// - Boştaki worker rastgele kurbanlardan iş çalar, bulamazsa uyur
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(size_t numThreads = 0);  // 0 = CPU sayısı kadar
+    ~WorkStealingPool();
+
+    // İş ekle; sonuç veya istisna Future'a yazılır
+    template <typename F, typename R = std::invoke_result_t<std::decay_t<F>&>>
+    Future<R> submit(F&& fn) {
+        Promise<R> promise;
+        Future<R> future = promise.getFuture();
+        enqueue([promise, fn = std::forward<F>(fn)]() mutable { promise.fulfill(fn); });
+        return future;
+    }
+
+    // Verilen her iş bitene kadar bekle (bariyer)
+    void waitIdle();
+
+    // Havuz boyutu
+    size_t size() const { return workers_.size(); }
+
+    // Bekleyen iş sayısı
+    size_t pending() const;
+
+    // Durdur (kuyruktaki işler bitirilir)
+    void shutdown();
+
+private:
+    using Job = WorkStealingDeque::Job;
+
+    struct WorkerState {
+        WorkStealingDeque deque;
+        std::minstd_rand rng;
+    };
+
+    std::vector<std::thread> workers_;
+    std::vector<std::unique_ptr<WorkerState>> states_;
+
+    // Havuz dışından gelen işler
+    std::mutex injectMutex_;
+    std::deque<Job*> inject_;
+    std::atomic<size_t> injectSize_{0};
+
+    // Boştaki worker'ların uyuması
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCv_;
+    std::atomic<size_t> idle_{0};
+
+    std::atomic<size_t> pending_{0};  // Kuyruklarda bekleyen (alınmamış) iş
+    std::atomic<bool> stop_{false};
+
+    // Bitmemiş iş (bekleyen + çalışan); sıfıra inince waitIdle uyanır
+    std::atomic<size_t> outstanding_{0};
+    std::atomic<size_t> idleWaiters_{0};
+    std::mutex idleMutex_;
+    std::condition_variable idleCv_;
+
+    void enqueue(std::function<void()> job);
+    void workerLoop(size_t index);
+    Job* findJob(size_t index);
+    Job* popInject();
+};
+
+} // namespace jts
+
+#endif
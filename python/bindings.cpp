@@ -1,5 +1,6 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <pybind11/chrono.h>
 #include "task.hpp"
 #include "task_registry.hpp"
 #include "scheduler.hpp"
@@ -21,18 +22,38 @@ PYBIND11_MODULE(jetson_scheduler, m) {
         .def_readwrite("type", &jts::Task::type)
         .def_readwrite("priority", &jts::Task::priority)
         .def_readwrite("realtime", &jts::Task::realtime)
+        .def_readwrite("period", &jts::Task::period)
+        .def_readwrite("deadline", &jts::Task::deadline)
+        .def_readwrite("phase", &jts::Task::phase)
+        .def_readwrite("wcet", &jts::Task::wcet)
+        .def_readonly("activations", &jts::Task::activations)
+        .def_readonly("deadline_misses", &jts::Task::deadline_misses)
+        .def_readonly("budget_overruns", &jts::Task::budget_overruns)
+        .def_readonly("max_runtime", &jts::Task::max_runtime)
         .def("summary", &jts::Task::summary)
         .def("serialize", &jts::Task::serialize);
 
     py::class_<jts::TaskRegistry>(m, "TaskRegistry")
         .def(py::init<>())
-        .def("register_task", &jts::TaskRegistry::registerTask)
+        .def("register_task", py::overload_cast<jts::Task>(&jts::TaskRegistry::registerTask))
         .def("list_tasks", &jts::TaskRegistry::listTasks)
         .def("count", &jts::TaskRegistry::count);
 
     py::class_<jts::Scheduler>(m, "Scheduler")
         .def(py::init<>())
-        .def("add_task", &jts::Scheduler::addTask)
+        .def(py::init<size_t>(), py::arg("num_workers"))
+        .def("add_task", py::overload_cast<jts::Task>(&jts::Scheduler::addTask))
+        .def("add_task_after",
+             py::overload_cast<jts::Task, std::chrono::steady_clock::duration>(
+                 &jts::Scheduler::addTaskAfter))
+        .def("cancel_task", &jts::Scheduler::cancelTask)
+        .def("deadline_misses", &jts::Scheduler::deadlineMisses)
         .def("run_once", &jts::Scheduler::runOnce)
-        .def("pending_count", &jts::Scheduler::pendingCount);
+        .def("pending_count", &jts::Scheduler::pendingCount)
+        .def("worker_count", &jts::Scheduler::workerCount)
+        .def("wait", py::overload_cast<const std::vector<uint64_t>&>(&jts::Scheduler::wait),
+             py::call_guard<py::gil_scoped_release>())
+        .def("wait_idle", &jts::Scheduler::waitIdle, py::call_guard<py::gil_scoped_release>())
+        .def("start", &jts::Scheduler::start)
+        .def("stop", &jts::Scheduler::stop);
 }
\ No newline at end of file
@@ -0,0 +1,460 @@
+#include "async_io.hpp"
+#include "scheduler.hpp"
+#include "thread_pool.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+// Linux headers
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(SYS_io_uring_setup) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define JTS_HAVE_IO_URING 1
+#endif
+
+namespace jts {
+
+namespace {
+
+// io_uring: POLL_REMOVE'un kendi CQE'si (Op adresleri hizalı, 0 çık işareti)
+constexpr uint64_t kCancelTag = 1;
+
+} // namespace
+
+#ifdef JTS_HAVE_IO_URING
+
+// Çekirdekle paylaşılan halkalar: head/tail karşı tarafça değiştirilir,
+// sadece acquire/release ile okunur/yazılır
+struct AsyncIo::Ring {
+    int fd = -1;
+    void* sqPtr = MAP_FAILED;
+    size_t sqSize = 0;
+    void* cqPtr = MAP_FAILED;
+    size_t cqSize = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqesSize = 0;
+
+    unsigned* sqHead = nullptr;
+    unsigned* sqTail = nullptr;
+    unsigned* sqArray = nullptr;
+    unsigned sqMask = 0;
+    unsigned* cqHead = nullptr;
+    unsigned* cqTail = nullptr;
+    io_uring_cqe* cqes = nullptr;
+    unsigned cqMask = 0;
+    unsigned cqEntries = 0;
+
+    ~Ring() {
+        if (sqes != MAP_FAILED) munmap(sqes, sqesSize);
+        if (cqPtr != MAP_FAILED && cqPtr != sqPtr) munmap(cqPtr, cqSize);
+        if (sqPtr != MAP_FAILED) munmap(sqPtr, sqSize);
+        if (fd >= 0) close(fd);
+    }
+
+    static std::unique_ptr<Ring> create(unsigned entries) {
+        io_uring_params params;
+        std::memset(&params, 0, sizeof(params));
+        auto ring = std::make_unique<Ring>();
+        ring->fd = static_cast<int>(syscall(SYS_io_uring_setup, entries, &params));
+        if (ring->fd < 0) {
+            JTS_LOG_INFO("[AsyncIo] io_uring yok (%s), ThreadPool kullanılacak",
+                         std::strerror(errno));
+            return nullptr;
+        }
+        // IORING_OP_READ/WRITE ile aynı sürümde (5.6) gelen özellik: yoksa
+        // halka kurulur ama işlemler EINVAL ile döner
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+            JTS_LOG_INFO("[AsyncIo] Çekirdek io_uring READ/WRITE desteklemiyor, ThreadPool kullanılacak");
+            return nullptr;
+        }
+
+        ring->sqSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool single = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single) ring->sqSize = ring->cqSize = std::max(ring->sqSize, ring->cqSize);
+
+        ring->sqPtr = mmap(nullptr, ring->sqSize, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+        if (ring->sqPtr == MAP_FAILED) return nullptr;
+        ring->cqPtr = single ? ring->sqPtr
+                             : mmap(nullptr, ring->cqSize, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cqPtr == MAP_FAILED) return nullptr;
+        ring->sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        ring->sqes = static_cast<io_uring_sqe*>(
+            mmap(nullptr, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                 ring->fd, IORING_OFF_SQES));
+        if (ring->sqes == MAP_FAILED) return nullptr;
+
+        char* sq = static_cast<char*>(ring->sqPtr);
+        ring->sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        ring->sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        ring->sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        ring->sqMask = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        char* cq = static_cast<char*>(ring->cqPtr);
+        ring->cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        ring->cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        ring->cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        ring->cqMask = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        ring->cqEntries = params.cq_entries;
+        return ring;
+    }
+
+    // Tek SQE ekle ve gönder (gönderim kilidi altında: tek yazar)
+    void push(uint8_t opcode, int fileFd, void* buf, size_t len, uint64_t offset,
+              uint64_t userData) {
+        unsigned tail = *sqTail;
+        unsigned index = tail & sqMask;
+        io_uring_sqe* sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = opcode;
+        sqe->fd = fileFd;
+        sqe->addr = reinterpret_cast<uint64_t>(buf);
+        sqe->len = static_cast<uint32_t>(len);
+        if (opcode == IORING_OP_POLL_ADD) {
+            // Olay maskesi off yerine poll32_events'te (büyük endian'da yarım kelimeler ters)
+            uint32_t events = static_cast<uint32_t>(offset);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            events = (events << 16) | (events >> 16);
+#endif
+            sqe->poll32_events = events;
+        } else {
+            sqe->off = offset;
+        }
+        sqe->user_data = userData;
+        sqArray[index] = index;
+        __atomic_store_n(sqTail, tail + 1, __ATOMIC_RELEASE);
+
+        // SQPOLL yok: çekirdek SQE'yi bu çağrıda tüketir, halka hiç dolmaz
+        while (syscall(SYS_io_uring_enter, fd, 1, 0, 0, nullptr, 0) < 0) {
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                JTS_LOG_ERROR("[AsyncIo] io_uring_enter: %s", std::strerror(errno));
+                break;
+            }
+            std::this_thread::yield();
+        }
+    }
+};
+
+#else
+
+struct AsyncIo::Ring {
+    unsigned cqEntries = 0;
+    static std::unique_ptr<Ring> create(unsigned) { return nullptr; }
+};
+
+#endif
+
+AsyncIo::AsyncIo(Scheduler& scheduler, const AsyncIoOptions& options)
+    : scheduler_(scheduler) {
+    if (!options.forceFallback) {
+        ring_ = Ring::create(std::max(1u, options.entries));
+    }
+    if (ring_) {
+        maxInFlight_ = ring_->cqEntries;  // CQ taşmaz
+        reaper_ = std::thread([this]() { reapLoop(); });
+    } else {
+        maxInFlight_ = 2 * std::max(1u, options.entries);
+        pool_ = std::make_unique<ThreadPool>(std::max<size_t>(1, options.fallbackThreads));
+        wakeFd_ = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wakeFd_ < 0) {
+            JTS_LOG_WARN("[AsyncIo] eventfd: %s, poll thread'i yoklamayla uyanacak",
+                         std::strerror(errno));
+        }
+        poller_ = std::thread([this]() { pollLoop(); });
+    }
+}
+
+AsyncIo::~AsyncIo() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closing_ = true;  // Devam görevinden yeniden kurulan poll drain()'i tutmasın
+    }
+    cancelPolls();
+    drain();
+    if (poller_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopPoller_ = true;
+            wakePoller();
+        }
+        poller_.join();
+    }
+    if (wakeFd_ >= 0) close(wakeFd_);
+#ifdef JTS_HAVE_IO_URING
+    if (ring_) {
+        // user_data 0: tamamlama thread'ine çık işareti
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ring_->push(IORING_OP_NOP, -1, nullptr, 0, 0, 0);
+        }
+        reaper_.join();
+    }
+#endif
+    pool_.reset();
+}
+
+Task AsyncIo::defaultFollowUp() {
+    Task t;
+    t.name = "io_done";
+    t.type = TaskType::IO;
+    return t;
+}
+
+void AsyncIo::read(int fd, void* buf, size_t len, uint64_t offset, IoCallback done) {
+    submit(OpCode::Read, fd, buf, len, offset, defaultFollowUp(), std::move(done));
+}
+
+void AsyncIo::read(int fd, void* buf, size_t len, uint64_t offset, Task followUp,
+                   IoCallback done) {
+    submit(OpCode::Read, fd, buf, len, offset, std::move(followUp), std::move(done));
+}
+
+void AsyncIo::write(int fd, const void* buf, size_t len, uint64_t offset, IoCallback done) {
+    submit(OpCode::Write, fd, const_cast<void*>(buf), len, offset, defaultFollowUp(),
+           std::move(done));
+}
+
+void AsyncIo::write(int fd, const void* buf, size_t len, uint64_t offset, Task followUp,
+                    IoCallback done) {
+    submit(OpCode::Write, fd, const_cast<void*>(buf), len, offset, std::move(followUp),
+           std::move(done));
+}
+
+void AsyncIo::fsync(int fd, IoCallback done) {
+    submit(OpCode::Fsync, fd, nullptr, 0, 0, defaultFollowUp(), std::move(done));
+}
+
+void AsyncIo::fsync(int fd, Task followUp, IoCallback done) {
+    submit(OpCode::Fsync, fd, nullptr, 0, 0, std::move(followUp), std::move(done));
+}
+
+void AsyncIo::poll(int fd, short events, IoCallback done) {
+    submit(OpCode::Poll, fd, nullptr, 0, static_cast<uint16_t>(events), defaultFollowUp(),
+           std::move(done));
+}
+
+void AsyncIo::poll(int fd, short events, Task followUp, IoCallback done) {
+    submit(OpCode::Poll, fd, nullptr, 0, static_cast<uint16_t>(events), std::move(followUp),
+           std::move(done));
+}
+
+void AsyncIo::submit(OpCode code, int fd, void* buf, size_t len, uint64_t offset, Task followUp,
+                     IoCallback done) {
+    // Devam görevi tek seferliktir: periyodik olsa done() her periyotta
+    // yeniden çağrılırdı, phase/wcet de gecikme ve kabul sınavı getirirdi
+    followUp.period = followUp.phase = followUp.wcet = std::chrono::microseconds(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return inFlight_ < maxInFlight_; });
+    Op* op = ops_.create(Op{code, fd, buf, len, offset, std::move(followUp), std::move(done)});
+    inFlight_++;
+    submitted_.fetch_add(1, std::memory_order_release);
+
+    if (code == OpCode::Poll) {
+        if (closing_) {
+            lock.unlock();
+            complete(op, -ECANCELED);
+            return;
+        }
+        polls_.push_back(op);
+        if (!ring_) {
+            wakePoller();  // Kilit altında: yıkıcı eventfd'yi kapatmış olamaz
+            return;
+        }
+    }
+
+#ifdef JTS_HAVE_IO_URING
+    if (ring_) {
+        static const uint8_t opcodes[] = {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_FSYNC,
+                                          IORING_OP_POLL_ADD};
+        ring_->push(opcodes[static_cast<int>(code)], fd, buf, len, offset,
+                    reinterpret_cast<uint64_t>(op));
+        return;
+    }
+#endif
+    // Kilit bırakılmadan kuyruğa koy: iş hemen biterse drain() dönüp havuzu
+    // yok edebilir, bu thread enqueue içindeyken değil
+    pool_->submit([this, op]() { complete(op, runBlocking(*op)); });
+}
+
+int64_t AsyncIo::runBlocking(const Op& op) {
+    ssize_t n = 0;
+    switch (op.code) {
+        case OpCode::Read:
+            n = pread(op.fd, op.buf, op.len, static_cast<off_t>(op.offset));
+            break;
+        case OpCode::Write:
+            n = pwrite(op.fd, op.buf, op.len, static_cast<off_t>(op.offset));
+            break;
+        case OpCode::Fsync:
+            n = ::fsync(op.fd);
+            break;
+        case OpCode::Poll:
+            break;  // pollLoop()'ta
+    }
+    return n < 0 ? -static_cast<int64_t>(errno) : static_cast<int64_t>(n);
+}
+
+void AsyncIo::complete(Op* op, int64_t result) {
+    // Devam görevi uçuş sayacı düşmeden eklenir: drain() dönünce hepsi kayıtlı
+    if (op->done) {
+        if (!CpuMask::representable(op->followUp.cpu_cores)) {
+            // Scheduler reddederdi (done kaybolurdu): burada çalıştır
+            rejectedFollowUps_.fetch_add(1, std::memory_order_relaxed);
+            JTS_LOG_WARN("[AsyncIo] Devam görevi reddedildi (cpu_cores): %s, done() burada çalışıyor",
+                         op->followUp.name.c_str());
+            op->done(result);
+        } else if (scheduler_.addTask(std::move(op->followUp),
+                                      [done = std::move(op->done), result]() { done(result); }) == 0) {
+            rejectedFollowUps_.fetch_add(1, std::memory_order_relaxed);
+            JTS_LOG_ERROR("[AsyncIo] Devam görevi reddedildi, done() çalışmadı");
+        }
+    }
+    completed_.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ring_ && op->code == OpCode::Poll) {
+        auto it = std::find(polls_.begin(), polls_.end(), op);
+        if (it != polls_.end()) {
+            *it = polls_.back();
+            polls_.pop_back();
+        }
+    }
+    ops_.destroy(op);
+    inFlight_--;
+    cv_.notify_all();
+}
+
+void AsyncIo::cancelPolls() {
+    std::unique_lock<std::mutex> lock(mutex_);
+#ifdef JTS_HAVE_IO_URING
+    if (ring_) {
+        // Her bekleyen poll için POLL_REMOVE (hedef user_data ile bulunur);
+        // poll -ECANCELED ile tamamlanır. Kaldırmanın CQE'si de uçuş sayılır:
+        // yer beklerken kilit bırakılır, liste her turda yeniden taranır
+        for (;;) {
+            cv_.wait(lock, [this]() { return inFlight_ < maxInFlight_; });
+            auto it = std::find_if(polls_.begin(), polls_.end(),
+                                   [](const Op* op) { return !op->cancelling; });
+            if (it == polls_.end()) return;
+            (*it)->cancelling = true;
+            inFlight_++;
+            ring_->push(IORING_OP_POLL_REMOVE, -1, *it, 0, 0, kCancelTag);
+        }
+    }
+#endif
+    if (!ring_ && !polls_.empty()) {
+        cancelPolls_ = true;
+        wakePoller();
+    }
+}
+
+void AsyncIo::wakePoller() {
+    if (wakeFd_ < 0) return;
+    uint64_t one = 1;
+    // Sayaç taşmaz (poll thread'i her uyanışta okur); EAGAIN zararsız
+    if (::write(wakeFd_, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+        JTS_LOG_ERROR("[AsyncIo] eventfd yazılamadı: %s", std::strerror(errno));
+    }
+}
+
+void AsyncIo::pollLoop() {
+    // fds[0] eventfd; fds[i + 1] <-> polls_[i]. polls_'tan sadece bu thread
+    // siler, ekleyenler sona ekler: ::poll dönüşünde eşleşme geçerlidir
+    std::vector<pollfd> fds;
+    std::vector<std::pair<Op*, int64_t>> finished;
+    int64_t failed = 0;
+    for (;;) {
+        bool stop;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            size_t keep = 0;
+            for (size_t i = 0; i < polls_.size(); ++i) {
+                Op* op = polls_[i];
+                short revents = i + 1 < fds.size() ? fds[i + 1].revents : 0;
+                if (cancelPolls_) {
+                    finished.emplace_back(op, -ECANCELED);
+                } else if (failed < 0) {
+                    finished.emplace_back(op, failed);
+                } else if (revents != 0) {
+                    finished.emplace_back(op, static_cast<uint16_t>(revents));
+                } else {
+                    polls_[keep++] = op;
+                }
+            }
+            polls_.resize(keep);
+            cancelPolls_ = false;
+            failed = 0;
+            stop = stopPoller_;
+
+            fds.clear();
+            fds.push_back({wakeFd_, POLLIN, 0});
+            for (Op* op : polls_) fds.push_back({op->fd, static_cast<short>(op->offset), 0});
+        }
+
+        for (auto& f : finished) complete(f.first, f.second);
+        finished.clear();
+        if (stop) return;
+
+        // eventfd yoksa kısa aralıklarla yeni poll'lara bakılır
+        if (::poll(fds.data(), fds.size(), wakeFd_ >= 0 ? -1 : 10) < 0 && errno != EINTR) {
+            failed = -static_cast<int64_t>(errno);  // Bekleyenler hatayla biter, döngü dönmez
+            JTS_LOG_ERROR("[AsyncIo] poll: %s", std::strerror(errno));
+        }
+        if (fds[0].revents & POLLIN) {
+            uint64_t count;
+            while (::read(wakeFd_, &count, sizeof(count)) > 0) {}
+        }
+    }
+}
+
+void AsyncIo::reapLoop() {
+#ifdef JTS_HAVE_IO_URING
+    bool stop = false;
+    while (!stop) {
+        // En az bir tamamlama gelene kadar çekirdekte uyu
+        if (syscall(SYS_io_uring_enter, ring_->fd, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+            errno != EINTR) {
+            JTS_LOG_ERROR("[AsyncIo] io_uring_enter (bekleme): %s", std::strerror(errno));
+        }
+
+        unsigned head = *ring_->cqHead;
+        unsigned tail = __atomic_load_n(ring_->cqTail, __ATOMIC_ACQUIRE);
+        submitted_.load(std::memory_order_acquire);  // Gönderenlerin op yazımları görünür
+        while (head != tail) {
+            const io_uring_cqe& cqe = ring_->cqes[head & ring_->cqMask];
+            uint64_t userData = cqe.user_data;
+            int64_t result = cqe.res;
+            ++head;
+            if (userData == 0) {
+                stop = true;
+            } else if (userData == kCancelTag) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                inFlight_--;
+                cv_.notify_all();
+            } else {
+                complete(reinterpret_cast<Op*>(userData), result);
+            }
+        }
+        __atomic_store_n(ring_->cqHead, head, __ATOMIC_RELEASE);
+    }
+#endif
+}
+
+void AsyncIo::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return inFlight_ == 0; });
+}
+
+size_t AsyncIo::inFlight() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return inFlight_;
+}
+
+} // namespace jts
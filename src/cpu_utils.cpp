@@ -1,6 +1,8 @@
 #include "cpu_utils.hpp"
-#include <iostream>
+#include "logger.hpp"
+#include "topology.hpp"
 #include <cerrno>
+#include <cstdio>
 #include <cstring>
 
 // Linux headers
@@ -12,7 +14,7 @@
 namespace jts {
 
 int getCpuCount() {
-    return static_cast<int>(sysconf(_SC_NPROCESSORS_ONLN));
+    return static_cast<int>(Topology::system().size());
 }
 
 bool setCurrentThreadAffinity(const std::vector<int>& cores) {
@@ -21,24 +23,28 @@ bool setCurrentThreadAffinity(const std::vector<int>& cores) {
     cpu_set_t cpuset;
     CPU_ZERO(&cpuset);
     
+    // Çevrimiçi olmayan çekirdekler atlanır (liste seyrek olabilir: 0,2,3)
+    const Topology& topo = Topology::system();
     for (int core : cores) {
-        if (core >= 0 && core < getCpuCount()) {
+        if (core >= 0 && core < CPU_SETSIZE && topo.online(core)) {
             CPU_SET(core, &cpuset);
         }
     }
     
     int result = sched_setaffinity(0, sizeof(cpu_set_t), &cpuset);
     if (result != 0) {
-        std::cerr << "[CPU] Affinity ayarlanamadı: " << strerror(errno) << "\n";
+        JTS_LOG_WARN("[CPU] Affinity ayarlanamadı: %s", strerror(errno));
         return false;
     }
     
-    std::cout << "[CPU] Affinity ayarlandı: çekirdekler [";
-    for (size_t i = 0; i < cores.size(); ++i) {
-        std::cout << cores[i];
-        if (i < cores.size() - 1) std::cout << ",";
+    if (Logger::instance().enabled(LogLevel::Debug)) {
+        char list[128];
+        size_t len = 0;
+        for (size_t i = 0; i < cores.size() && len < sizeof(list); ++i) {
+            len += static_cast<size_t>(snprintf(list + len, sizeof(list) - len, i ? ",%d" : "%d", cores[i]));
+        }
+        JTS_LOG_DEBUG("[CPU] Affinity ayarlandı: çekirdekler [%s]", list);
     }
-    std::cout << "]\n";
     return true;
 }
 
@@ -48,15 +54,16 @@ bool setThreadAffinity(std::thread& thread, const std::vector<int>& cores) {
     cpu_set_t cpuset;
     CPU_ZERO(&cpuset);
     
+    const Topology& topo = Topology::system();
     for (int core : cores) {
-        if (core >= 0 && core < getCpuCount()) {
+        if (core >= 0 && core < CPU_SETSIZE && topo.online(core)) {
             CPU_SET(core, &cpuset);
         }
     }
     
     int result = pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
     if (result != 0) {
-        std::cerr << "[CPU] Thread affinity ayarlanamadı: " << strerror(result) << "\n";
+        JTS_LOG_WARN("[CPU] Thread affinity ayarlanamadı: %s", strerror(result));
         return false;
     }
     return true;
@@ -68,12 +75,12 @@ bool setRealtimeScheduling(int priority) {
     
     int result = sched_setscheduler(0, SCHED_FIFO, &param);
     if (result != 0) {
-        std::cerr << "[CPU] Realtime scheduling ayarlanamadı: " << strerror(errno);
-        std::cerr << " (root gerekli olabilir)\n";
+        JTS_LOG_WARN("[CPU] Realtime scheduling ayarlanamadı: %s (root gerekli olabilir)",
+                     strerror(errno));
         return false;
     }
     
-    std::cout << "[CPU] SCHED_FIFO ayarlandı, priority=" << priority << "\n";
+    JTS_LOG_DEBUG("[CPU] SCHED_FIFO ayarlandı, priority=%d", priority);
     return true;
 }
 
@@ -83,7 +90,7 @@ bool setNormalScheduling() {
     
     int result = sched_setscheduler(0, SCHED_OTHER, &param);
     if (result != 0) {
-        std::cerr << "[CPU] Normal scheduling ayarlanamadı: " << strerror(errno) << "\n";
+        JTS_LOG_WARN("[CPU] Normal scheduling ayarlanamadı: %s", strerror(errno));
         return false;
     }
     return true;
@@ -92,10 +99,10 @@ bool setNormalScheduling() {
 bool setNice(int nice_value) {
     int result = nice(nice_value);
     if (result == -1 && errno != 0) {
-        std::cerr << "[CPU] Nice ayarlanamadı: " << strerror(errno) << "\n";
+        JTS_LOG_WARN("[CPU] Nice ayarlanamadı: %s", strerror(errno));
         return false;
     }
-    std::cout << "[CPU] Nice ayarlandı: " << nice_value << "\n";
+    JTS_LOG_DEBUG("[CPU] Nice ayarlandı: %d", nice_value);
     return true;
 }
 
@@ -0,0 +1,55 @@
+#include "future.hpp"
+#include <cerrno>
+#include <climits>
+#include <ctime>
+
+// Linux headers
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace jts {
+namespace detail {
+
+namespace {
+
+uint32_t* wordOf(std::atomic<uint32_t>& word) {
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                  "futex için atomic<uint32_t> düz 32 bit olmalı");
+    return reinterpret_cast<uint32_t*>(&word);
+}
+
+} // namespace
+
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected, int64_t timeoutNs) {
+    struct timespec ts;
+    struct timespec* timeout = nullptr;
+    if (timeoutNs >= 0) {
+        ts.tv_sec = static_cast<time_t>(timeoutNs / 1000000000);
+        ts.tv_nsec = static_cast<long>(timeoutNs % 1000000000);
+        timeout = &ts;
+    }
+    // Değer expected değilse hemen döner (EAGAIN); uyandırma kaybolmaz
+    syscall(SYS_futex, wordOf(word), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+}
+
+void futexWaitUntil(std::atomic<uint32_t>& word, uint32_t expected, int64_t deadlineNs) {
+    struct timespec ts;
+    struct timespec* timeout = nullptr;
+    if (deadlineNs >= 0) {
+        ts.tv_sec = static_cast<time_t>(deadlineNs / 1000000000);
+        ts.tv_nsec = static_cast<long>(deadlineNs % 1000000000);
+        timeout = &ts;
+    }
+    // BITSET biçimi mutlak zaman alır (clock_nanosleep(TIMER_ABSTIME) gibi,
+    // geç uyanan thread'in hesapladığı göreli süre kaymaz)
+    syscall(SYS_futex, wordOf(word), FUTEX_WAIT_BITSET_PRIVATE, expected, timeout, nullptr,
+            FUTEX_BITSET_MATCH_ANY);
+}
+
+void futexWakeAll(std::atomic<uint32_t>& word) {
+    syscall(SYS_futex, wordOf(word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+}
+
+} // namespace detail
+} // namespace jts
@@ -0,0 +1,116 @@
+#include "histogram.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace jts {
+
+LatencyHistogram::LatencyHistogram() {
+    for (auto& c : counts_) c.store(0, std::memory_order_relaxed);
+}
+
+LatencyHistogram::LatencyHistogram(const LatencyHistogram& other) {
+    *this = other;
+}
+
+LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kBuckets; ++i) {
+        counts_[i].store(other.counts_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    count_.store(other.count_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    sum_.store(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    max_.store(other.max_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    return *this;
+}
+
+size_t LatencyHistogram::bucketIndex(int64_t valueNs) {
+    if (valueNs < kSubCount) {
+        return valueNs < 0 ? 0 : static_cast<size_t>(valueNs);  // Küçük değerler birebir
+    }
+    uint64_t v = static_cast<uint64_t>(valueNs);
+    int exp = 63 - __builtin_clzll(v);
+    if (exp > kMaxExp) return kBuckets - 1;
+
+    size_t sub = static_cast<size_t>(v >> (exp - kSubBits)) - kSubCount;
+    return kSubCount + static_cast<size_t>(exp - kSubBits) * kSubCount + sub;
+}
+
+int64_t LatencyHistogram::bucketUpper(size_t index) {
+    if (index < static_cast<size_t>(kSubCount)) return static_cast<int64_t>(index);
+    size_t rel = index - kSubCount;
+    int shift = static_cast<int>(rel / kSubCount);
+    int64_t sub = static_cast<int64_t>(rel % kSubCount);
+    return ((kSubCount + sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(int64_t valueNs) {
+    if (valueNs < 0) valueNs = 0;
+    bump(counts_[bucketIndex(valueNs)], 1);
+    bump(count_, 1);
+    sum_.store(sum_.load(std::memory_order_relaxed) + valueNs, std::memory_order_relaxed);
+    if (valueNs > max_.load(std::memory_order_relaxed)) {
+        max_.store(valueNs, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kBuckets; ++i) {
+        counts_[i].fetch_add(other.counts_[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    count_.fetch_add(other.count(), std::memory_order_relaxed);
+    sum_.fetch_add(other.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    if (other.max() > max()) {
+        max_.store(other.max(), std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::subtract(const LatencyHistogram& older) {
+    size_t highest = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        uint64_t now = counts_[i].load(std::memory_order_relaxed);
+        uint64_t old = older.counts_[i].load(std::memory_order_relaxed);
+        uint64_t diff = now > old ? now - old : 0;
+        counts_[i].store(diff, std::memory_order_relaxed);
+        if (diff > 0) highest = i;
+    }
+    uint64_t c = count(), oc = older.count();
+    count_.store(c > oc ? c - oc : 0, std::memory_order_relaxed);
+    sum_.fetch_sub(older.sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+    // Pencerenin tam max'ı bilinmez: en yüksek dolu kovanın üst sınırı
+    if (count() == 0) {
+        max_.store(0, std::memory_order_relaxed);
+    } else {
+        max_.store(std::min(max(), bucketUpper(highest)), std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::reset() {
+    for (auto& c : counts_) c.store(0, std::memory_order_relaxed);
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+double LatencyHistogram::mean() const {
+    uint64_t c = count();
+    return c == 0 ? 0.0 : static_cast<double>(sum_.load(std::memory_order_relaxed)) / c;
+}
+
+int64_t LatencyHistogram::percentile(double p) const {
+    uint64_t total = count();
+    if (total == 0) return 0;
+
+    uint64_t rank = static_cast<uint64_t>(std::ceil(p / 100.0 * total));
+    if (rank == 0) rank = 1;
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        seen += counts_[i].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            return std::min(bucketUpper(i), max());
+        }
+    }
+    return max();
+}
+
+} // namespace jts
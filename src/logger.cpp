@@ -0,0 +1,129 @@
+#include "logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+
+// Linux headers
+#include <sys/resource.h>
+
+namespace jts {
+
+const char* logLevelToString(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info:  return "INFO";
+        case LogLevel::Warn:  return "WARN";
+        case LogLevel::Error: return "ERROR";
+        case LogLevel::Off:   return "OFF";
+        default:              return "UNKNOWN";
+    }
+}
+
+void ConsoleSink::write(LogLevel level, const char* message, size_t length) {
+    std::ostream& out = level >= LogLevel::Warn ? std::cerr : std::cout;
+    out.write(message, static_cast<std::streamsize>(length));
+    out.put('\n');
+}
+
+void ConsoleSink::flush() {
+    std::cout.flush();
+    std::cerr.flush();
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+Logger::Logger()
+    : cells_(new Cell[kCapacity])
+    , sink_(std::make_shared<ConsoleSink>())
+{
+    for (size_t i = 0; i < kCapacity; ++i) {
+        cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    thread_ = std::thread([this]() { drainLoop(); });
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex_);
+        stop_ = true;
+    }
+    stopCv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    flush();
+}
+
+void Logger::setSink(std::shared_ptr<LogSink> sink) {
+    std::lock_guard<std::mutex> lock(drainMutex_);
+    drain();  // Eski sink'e ait mesajlar eski sink'e gitsin
+    sink_ = std::move(sink);
+}
+
+void Logger::log(LogLevel level, const char* format, ...) {
+    // Hücre ayır (sınırlı MPMC kuyruk, tek tüketiciyle kullanılıyor)
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true) {
+        cell = &cells_[pos & (kCapacity - 1)];
+        size_t seq = cell->seq.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // Dolu: beklemek yerine at
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    va_list args;
+    va_start(args, format);
+    int n = std::vsnprintf(cell->text, sizeof(cell->text), format, args);
+    va_end(args);
+
+    cell->level = level;
+    cell->length = static_cast<uint16_t>(n < 0 ? 0 : std::min<size_t>(static_cast<size_t>(n), kMaxMessage));
+    cell->seq.store(pos + 1, std::memory_order_release);
+}
+
+void Logger::drain() {
+    bool wrote = false;
+    while (true) {
+        Cell& cell = cells_[head_ & (kCapacity - 1)];
+        if (cell.seq.load(std::memory_order_acquire) != head_ + 1) break;
+        if (sink_) sink_->write(cell.level, cell.text, cell.length);
+        cell.seq.store(head_ + kCapacity, std::memory_order_release);
+        ++head_;
+        wrote = true;
+    }
+    if (wrote && sink_) sink_->flush();
+}
+
+void Logger::flush() {
+    std::lock_guard<std::mutex> lock(drainMutex_);
+    drain();
+}
+
+void Logger::drainLoop() {
+    // Log yazımı hiçbir iş thread'inin önüne geçmesin (Linux'ta thread başına)
+    setpriority(PRIO_PROCESS, 0, 19);
+
+    std::unique_lock<std::mutex> lock(stopMutex_);
+    while (!stop_) {
+        stopCv_.wait_for(lock, std::chrono::milliseconds(5), [this]() { return stop_; });
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+} // namespace jts
@@ -2,10 +2,26 @@
 #include "thread_pool.hpp"
 #include "metrics.hpp"
 #include "cpu_utils.hpp"
+#include "trace.hpp"
+#include "task_graph.hpp"
 #include <iostream>
 #include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Kullanım: task_demo [--trace trace.json]
+// --trace verilirse zaman çizelgesi Chrome trace JSON olarak yazılır
+// (chrome://tracing veya ui.perfetto.dev ile açılabilir)
+int main(int argc, char** argv) {
+    std::string tracePath;
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--trace") == 0) tracePath = argv[i + 1];
+    }
+    if (!tracePath.empty()) {
+        jts::Tracer::instance().enable();
+    }
 
-int main() {
     std::cout << "=== Jetson Task Scheduler ===\n\n";
 
     jts::MetricsCollector metrics;
@@ -14,9 +30,9 @@ int main() {
     // runTask: Görev simülasyonu yapan yardımcı lambda fonksiyon
     // Parametreler: id (görev kimliği), name (görev adı), ms (süre milisaniye)
     auto runTask = [&](uint64_t id, const std::string& name, int ms) {
-        metrics.recordStart(id, name);
+        auto token = metrics.recordStart(id, name);
         std::this_thread::sleep_for(std::chrono::milliseconds(ms));
-        metrics.recordEnd(id, true);
+        metrics.recordEnd(token, true);
     };
 
     pool.submit([&]() { runTask(1, "camera", 100); });
@@ -24,8 +40,52 @@ int main() {
     pool.submit([&]() { runTask(3, "tracking", 80); });
     pool.submit([&]() { runTask(4, "logger", 30); });
 
-    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    pool.waitIdle();  // Sabit uyku yerine bariyer
+
+    // Aynı pipeline bağımlılıklarıyla: camera -> ai -> {tracking, logger}
+    // tracking ve logger paralel çalışır; graf her karede yeniden kullanılır
+    jts::TaskGraph graph;
+    auto cam = graph.addNode("camera", [&]() { runTask(1, "camera", 10); });
+    auto ai = graph.addNode("ai", [&]() { runTask(2, "ai", 15); });
+    auto track = graph.addNode("tracking", [&]() { runTask(3, "tracking", 8); });
+    auto log = graph.addNode("logger", [&]() { runTask(4, "logger", 3); });
+    graph.addEdge(cam, ai);
+    graph.addEdge(ai, track);
+    graph.addEdge(ai, log);
+    for (int frame = 0; frame < 3; ++frame) {
+        graph.run(pool);
+    }
+    std::cout << "TaskGraph: " << graph.runs() << " kare tamamlandı\n";
+
     metrics.printSummary();
 
+    if (!tracePath.empty()) {
+        // Aynı pipeline'ı çoklu worker Scheduler üzerinden de çalıştır ki
+        // trace'te enqueue/dispatch olayları da görünsün
+        jts::Scheduler scheduler(2);
+        const char* names[] = {"sched_camera", "sched_ai", "sched_tracking", "sched_logger"};
+        const int durations[] = {10, 15, 8, 3};
+        std::vector<uint64_t> ids;
+        for (int i = 0; i < 4; ++i) {
+            jts::Task t;
+            t.name = names[i];
+            t.priority = 10 - i;
+            int ms = durations[i];
+            t.work = [ms]() { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); };
+            ids.push_back(scheduler.addTask(t));
+        }
+        scheduler.start();
+        scheduler.wait(ids);
+        scheduler.stop();
+
+        jts::Tracer::instance().disable();
+        if (jts::Tracer::instance().exportChromeTrace(tracePath)) {
+            std::cout << "\nTrace yazıldı: " << tracePath << " ("
+                      << jts::Tracer::instance().size() << " olay)\n";
+        } else {
+            std::cerr << "Trace yazılamadı: " << tracePath << "\n";
+        }
+    }
+
     return 0;
 }
@@ -1,51 +1,481 @@
 #include "metrics.hpp"
+#include <algorithm>
+#include <array>
+#include <iomanip>
 #include <iostream>
 
 namespace jts {
 
-void MetricsCollector::recordStart(uint64_t id, const std::string& name) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    TaskMetrics m;
-    m.task_id = id;
-    m.task_name = name;
-    m.start_time = std::chrono::steady_clock::now();
-    m.duration_ms = 0;
-    m.success = false;
-    metrics_.push_back(m);
+namespace {
+
+std::atomic<uint64_t> nextInstanceId{1};
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::chrono::steady_clock::time_point fromNs(int64_t ns) {
+    return std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::nanoseconds(ns)));
+}
+
+} // namespace
+
+// Tek üretici (sahip thread) / tek tüketici (drainMutex_ sahibi) halka tamponu
+struct MetricsCollector::ThreadRing {
+    static constexpr size_t kCapacity = 4096;  // 2'nin kuvveti
+
+    static constexpr size_t kOpen = 64;        // Eski API açık kayıt penceresi
+
+    std::unique_ptr<Record[]> slots{new Record[kCapacity]};
+    alignas(64) std::atomic<size_t> head{0};   // Tüketici okur
+    alignas(64) std::atomic<size_t> tail{0};   // Üretici yazar
+
+    std::atomic<bool> retired{false};   // Sahip thread çıktı (son push'tan sonra, release)
+    std::atomic<bool> orphaned{false};  // Collector yok edildi, önbellekten düşülebilir
+
+    // Sadece sahip thread erişir
+    std::unordered_map<std::string, uint32_t> nameCache;
+    // recordStart(id, ad) açılışları; döngüsel, silme yok (start_ns 0: kapalı)
+    std::array<MetricsToken, kOpen> open{};
+    size_t openNext = 0;
+    std::vector<LatencyHistogram*> histByName;  // name id -> bu thread'in histogramı
+
+    bool push(const Record& r) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == kCapacity) return false;
+        slots[t & (kCapacity - 1)] = r;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename F>
+    void consume(F&& f) {
+        size_t h = head.load(std::memory_order_relaxed);
+        size_t t = tail.load(std::memory_order_acquire);
+        for (; h != t; ++h) {
+            f(slots[h & (kCapacity - 1)]);
+        }
+        head.store(h, std::memory_order_release);
+    }
+};
+
+MetricsCollector::MetricsCollector(size_t historyLimit, std::chrono::milliseconds drainInterval,
+                                   std::chrono::milliseconds snapshotInterval)
+    : instanceId_(nextInstanceId.fetch_add(1))
+    , historyLimit_(historyLimit)
+    , drainInterval_(drainInterval)
+    , snapshotInterval_(snapshotInterval)
+    , gauges_(new Gauge[kMaxGauges])
+{
+    aggregator_ = std::thread([this]() { aggregatorLoop(); });
+}
+
+MetricsCollector::~MetricsCollector() {
+    {
+        std::lock_guard<std::mutex> lock(stopMutex_);
+        stop_ = true;
+    }
+    stopCv_.notify_all();
+    if (aggregator_.joinable()) {
+        aggregator_.join();
+    }
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    for (const auto& ring : rings_) ring->orphaned.store(true, std::memory_order_relaxed);
+}
+
+MetricsCollector::ThreadRing& MetricsCollector::localRing() {
+    // (collector id, halka) çiftleri; id'ler tekrar kullanılmadığı için
+    // yok edilmiş bir collector'ın kaydı asla eşleşmez. Thread çıkarken
+    // halkalarını emekli eder; toplayıcı onları boşaltıp bırakır
+    struct LocalRings {
+        std::vector<std::pair<uint64_t, std::shared_ptr<ThreadRing>>> entries;
+        ~LocalRings() {
+            for (auto& entry : entries) entry.second->retired.store(true, std::memory_order_release);
+        }
+    };
+    thread_local LocalRings cache;
+    for (const auto& entry : cache.entries) {
+        if (entry.first == instanceId_) return *entry.second;
+    }
+
+    // Yeni halka eklenirken ölü collector'lara ait olanlar bırakılır
+    auto& entries = cache.entries;
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const auto& entry) {
+        return entry.second->orphaned.load(std::memory_order_relaxed);
+    }), entries.end());
+
+    auto ring = std::make_shared<ThreadRing>();
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings_.push_back(ring);
+    }
+    entries.emplace_back(instanceId_, ring);
+    return *ring;
+}
+
+void MetricsCollector::reclaimRetired() {
+    std::vector<std::shared_ptr<ThreadRing>> retired;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        for (size_t i = 0; i < rings_.size();) {
+            if (rings_[i]->retired.load(std::memory_order_acquire)) {
+                retired.push_back(std::move(rings_[i]));
+                rings_[i] = std::move(rings_.back());  // Sıra önemsiz
+                rings_.pop_back();
+            } else {
+                ++i;
+            }
+        }
+    }
+    if (retired.empty()) return;
+
+    // Son kayıtlar geçmişe
+    {
+        std::lock_guard<std::mutex> lock(drainMutex_);
+        for (const auto& ring : retired) {
+            ring->consume([this](const Record& r) {
+                history_.push_back(r);
+                if (history_.size() > historyLimit_) history_.pop_front();
+            });
+        }
+    }
+
+    // Histogramlar ad başına birikimliye katılır (toplamlar değişmez,
+    // pencere sorgusunun anlık görüntü farkı bozulmaz)
+    std::lock_guard<std::mutex> lock(histMutex_);
+    for (const auto& ring : retired) {
+        for (size_t i = 0; i < histograms_.size();) {
+            HistogramEntry& entry = histograms_[i];
+            if (entry.owner != ring.get()) {
+                ++i;
+                continue;
+            }
+            auto total = std::find_if(histograms_.begin(), histograms_.end(),
+                                      [&entry](const HistogramEntry& e) {
+                return !e.owner && e.name_id == entry.name_id;
+            });
+            if (total == histograms_.end()) {
+                entry.owner = nullptr;  // Bu adın ilk birikimlisi
+                ++i;
+                continue;
+            }
+            total->hist->merge(*entry.hist);
+            histograms_.erase(histograms_.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+}
+
+size_t MetricsCollector::threadRings() const {
+    std::lock_guard<std::mutex> lock(ringsMutex_);
+    return rings_.size();
+}
+
+LatencyHistogram& MetricsCollector::localHistogram(ThreadRing& ring, uint32_t nameId) {
+    if (nameId < ring.histByName.size() && ring.histByName[nameId]) {
+        return *ring.histByName[nameId];
+    }
+
+    // Bu thread bu adı ilk kez görüyor: histogram bir kez oluşturulur
+    auto hist = std::make_unique<LatencyHistogram>();
+    LatencyHistogram* raw = hist.get();
+    {
+        std::lock_guard<std::mutex> lock(histMutex_);
+        histograms_.push_back({nameId, &ring, std::move(hist)});
+    }
+    if (nameId >= ring.histByName.size()) {
+        ring.histByName.resize(nameId + 1, nullptr);
+    }
+    ring.histByName[nameId] = raw;
+    return *raw;
+}
+
+uint32_t MetricsCollector::internName(const std::string& name) {
+    std::lock_guard<std::mutex> lock(namesMutex_);
+    auto it = nameIds_.find(name);
+    if (it != nameIds_.end()) return it->second;
+
+    uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.push_back(name);
+    nameIds_.emplace(name, id);
+    return id;
+}
+
+MetricsToken MetricsCollector::recordStart(uint64_t id, const std::string& name) {
+    // İsim önce thread'in kendi önbelleğinde aranır, global kilit sadece
+    // ilk görüşte alınır
+    ThreadRing& ring = localRing();
+    auto it = ring.nameCache.find(name);
+    uint32_t nameId;
+    if (it != ring.nameCache.end()) {
+        nameId = it->second;
+    } else {
+        nameId = internName(name);
+        ring.nameCache.emplace(name, nameId);
+    }
+
+    // Eski recordEnd(id) bu biçimle eşleşir: açılış pencereye yazılır
+    // (sayı kimliği ile açan sıcak yol bunu hiç yapmaz)
+    MetricsToken token{id, nowNs(), nameId};
+    ring.open[ring.openNext++ % ThreadRing::kOpen] = token;
+    return token;
+}
+
+MetricsToken MetricsCollector::recordStart(uint64_t id, uint32_t nameId) {
+    return MetricsToken{id, nowNs(), nameId};
+}
+
+void MetricsCollector::recordEnd(const MetricsToken& token, bool success) {
+    Record r{token.task_id, token.start_ns, nowNs(), token.name_id, success};
+    ThreadRing& ring = localRing();
+
+    // Token ile kapatılan en son açılış eski API'de tekrar kapatılmasın
+    MetricsToken& last = ring.open[(ring.openNext - 1) % ThreadRing::kOpen];
+    if (last.task_id == token.task_id && last.start_ns == token.start_ns) last.start_ns = 0;
+
+    if (!ring.push(r)) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Histogram kayıt anında güncellenir (halka dolu olsa bile)
+    localHistogram(ring, token.name_id).record(r.end_ns - r.start_ns);
 }
 
 void MetricsCollector::recordEnd(uint64_t id, bool success) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (auto& m : metrics_) {
-        if (m.task_id == id && m.duration_ms == 0) {
-            m.end_time = std::chrono::steady_clock::now();
-            m.duration_ms = std::chrono::duration<double, std::milli>(
-                m.end_time - m.start_time).count();
-            m.success = success;
-            break;
+    ThreadRing& ring = localRing();
+    size_t window = std::min(ring.openNext, ThreadRing::kOpen);
+    for (size_t i = 1; i <= window; ++i) {
+        MetricsToken& open = ring.open[(ring.openNext - i) % ThreadRing::kOpen];
+        if (open.start_ns != 0 && open.task_id == id) {
+            MetricsToken token = open;
+            open.start_ns = 0;
+            recordEnd(token, success);
+            return;
         }
     }
 }
 
+void MetricsCollector::drain() const {
+    // Sahiplik kopyalanır: drainMutex_ beklenirken reclaimRetired() halkayı
+    // rings_'ten çıkarsa bile son referans burada kalır
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock(ringsMutex_);
+        rings = rings_;
+    }
+
+    std::lock_guard<std::mutex> lock(drainMutex_);
+    for (const auto& ring : rings) {
+        ring->consume([this](const Record& r) {
+            history_.push_back(r);
+            if (history_.size() > historyLimit_) history_.pop_front();
+        });
+    }
+}
+
+std::vector<LatencyHistogram> MetricsCollector::mergedHistograms() const {
+    size_t nameCount;
+    {
+        std::lock_guard<std::mutex> lock(namesMutex_);
+        nameCount = names_.size();
+    }
+
+    std::vector<LatencyHistogram> merged(nameCount);
+    std::lock_guard<std::mutex> lock(histMutex_);
+    for (const auto& entry : histograms_) {
+        if (entry.name_id < nameCount) {
+            merged[entry.name_id].merge(*entry.hist);
+        }
+    }
+    for (size_t i = 0; i < merged.size() && i < clearBase_.size(); ++i) {
+        merged[i].subtract(clearBase_[i]);
+    }
+    return merged;
+}
+
+void MetricsCollector::takeSnapshot() {
+    Snapshot snap{nowNs(), mergedHistograms()};
+    std::lock_guard<std::mutex> lock(snapMutex_);
+    snapshots_.push_back(std::move(snap));
+    if (snapshots_.size() > kMaxSnapshots) snapshots_.pop_front();
+}
+
+void MetricsCollector::aggregatorLoop() {
+    auto nextSnapshot = std::chrono::steady_clock::now() + snapshotInterval_;
+    std::unique_lock<std::mutex> lock(stopMutex_);
+    while (!stop_) {
+        stopCv_.wait_for(lock, drainInterval_, [this]() { return stop_; });
+        lock.unlock();
+        drain();
+        reclaimRetired();
+        if (std::chrono::steady_clock::now() >= nextSnapshot) {
+            takeSnapshot();
+            nextSnapshot += snapshotInterval_;
+        }
+        lock.lock();
+    }
+}
+
 std::vector<TaskMetrics> MetricsCollector::getAll() const {
-    std::lock_guard<std::mutex> lock(mutex_);
-    return metrics_;
+    drain();
+
+    std::lock_guard<std::mutex> lock(drainMutex_);
+    std::lock_guard<std::mutex> namesLock(namesMutex_);
+    std::vector<TaskMetrics> out;
+    out.reserve(history_.size());
+    for (const auto& r : history_) {
+        TaskMetrics m;
+        m.task_id = r.task_id;
+        m.task_name = names_[r.name_id];
+        m.start_time = fromNs(r.start_ns);
+        m.end_time = fromNs(r.end_ns);
+        m.duration_ms = (r.end_ns - r.start_ns) / 1e6;
+        m.success = r.success;
+        out.push_back(std::move(m));
+    }
+    return out;
+}
+
+std::vector<LatencyStats> MetricsCollector::latencyStats(std::chrono::milliseconds window) const {
+    auto merged = mergedHistograms();
+
+    if (window.count() > 0) {
+        // Pencere başına en yakın (ondan önceki) anlık görüntüyü çıkar;
+        // yoksa elimizdeki en eski görüntü kullanılır
+        int64_t from = nowNs() - std::chrono::duration_cast<std::chrono::nanoseconds>(window).count();
+        std::lock_guard<std::mutex> lock(snapMutex_);
+        const Snapshot* base = nullptr;
+        for (const auto& snap : snapshots_) {
+            if (snap.time_ns <= from) base = &snap;
+        }
+        if (!base && !snapshots_.empty()) base = &snapshots_.front();
+        if (base) {
+            for (size_t i = 0; i < merged.size() && i < base->perName.size(); ++i) {
+                merged[i].subtract(base->perName[i]);
+            }
+        }
+    }
+
+    std::vector<LatencyStats> out;
+    std::lock_guard<std::mutex> lock(namesMutex_);
+    for (size_t i = 0; i < merged.size(); ++i) {
+        const auto& h = merged[i];
+        if (h.count() == 0) continue;
+        out.push_back({names_[i], h.count(), h.mean() / 1e6,
+                       h.percentile(50) / 1e6, h.percentile(90) / 1e6,
+                       h.percentile(99) / 1e6, h.percentile(99.9) / 1e6,
+                       h.max() / 1e6});
+    }
+    return out;
+}
+
+uint32_t MetricsCollector::registerGauge(const std::string& name) {
+    std::lock_guard<std::mutex> lock(gaugeMutex_);
+    uint32_t count = gaugeCount_.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (gauges_[i].name == name) return i;
+    }
+    if (count == kMaxGauges) return kInvalidGauge;
+
+    gauges_[count].name = name;
+    gaugeCount_.store(count + 1, std::memory_order_release);
+    return count;
+}
+
+void MetricsCollector::setGauge(uint32_t gaugeId, int64_t value) {
+    if (gaugeId >= kMaxGauges) return;
+    Gauge& g = gauges_[gaugeId];
+    g.last.store(value, std::memory_order_relaxed);
+    int64_t prev = g.max.load(std::memory_order_relaxed);
+    while (value > prev &&
+           !g.max.compare_exchange_weak(prev, value, std::memory_order_relaxed)) {
+    }
+    g.sum.fetch_add(value, std::memory_order_relaxed);
+    g.samples.fetch_add(1, std::memory_order_relaxed);
 }
 
-void MetricsCollector::printSummary() const {
-    std::lock_guard<std::mutex> lock(mutex_);
+std::vector<GaugeStats> MetricsCollector::gaugeStats() const {
+    std::vector<GaugeStats> out;
+    uint32_t count = gaugeCount_.load(std::memory_order_acquire);
+    for (uint32_t i = 0; i < count; ++i) {
+        const Gauge& g = gauges_[i];
+        uint64_t n = g.samples.load(std::memory_order_relaxed);
+        out.push_back({g.name, g.last.load(std::memory_order_relaxed),
+                       g.max.load(std::memory_order_relaxed),
+                       n ? double(g.sum.load(std::memory_order_relaxed)) / n : 0.0, n});
+    }
+    return out;
+}
+
+void MetricsCollector::printSummary(std::chrono::milliseconds window) const {
+    auto stats = latencyStats(window);
     std::cout << "\n=== METRICS ===\n";
+    std::cout << std::left << std::setw(20) << "task" << std::right
+              << std::setw(8) << "count" << std::setw(10) << "mean"
+              << std::setw(10) << "p50" << std::setw(10) << "p90"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(10) << "max" << "  (ms)\n";
+
+    std::ios::fmtflags flags = std::cout.flags();
+    std::cout << std::fixed << std::setprecision(3);
     double total = 0;
-    for (const auto& m : metrics_) {
-        std::cout << m.task_name << ": " << m.duration_ms << "ms\n";
-        total += m.duration_ms;
+    for (const auto& s : stats) {
+        std::cout << std::left << std::setw(20) << s.task_name << std::right
+                  << std::setw(8) << s.count << std::setw(10) << s.mean_ms
+                  << std::setw(10) << s.p50_ms << std::setw(10) << s.p90_ms
+                  << std::setw(10) << s.p99_ms << std::setw(10) << s.p999_ms
+                  << std::setw(10) << s.max_ms << "\n";
+        total += s.mean_ms * s.count;
     }
     std::cout << "TOTAL: " << total << "ms\n";
+
+    auto gauges = gaugeStats();
+    if (!gauges.empty()) {
+        std::cout << std::left << std::setw(20) << "gauge" << std::right
+                  << std::setw(8) << "last" << std::setw(10) << "max"
+                  << std::setw(10) << "mean" << std::setw(10) << "samples" << "\n";
+        for (const auto& g : gauges) {
+            std::cout << std::left << std::setw(20) << g.name << std::right
+                      << std::setw(8) << g.last << std::setw(10) << g.max
+                      << std::setw(10) << g.mean << std::setw(10) << g.samples << "\n";
+        }
+    }
+    std::cout.flags(flags);
+    if (dropped() > 0) {
+        std::cout << "DROPPED: " << dropped() << "\n";
+    }
 }
 
 void MetricsCollector::clear() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    metrics_.clear();
+    drain();
+    {
+        std::lock_guard<std::mutex> lock(drainMutex_);
+        history_.clear();
+    }
+    {
+        // Sahip thread'ler kilitsiz yazar (tek yazıcı): sıfırlamak yerine
+        // o anki toplamlar taban olur, sorgular tabanı çıkarır
+        size_t nameCount;
+        {
+            std::lock_guard<std::mutex> lock(namesMutex_);
+            nameCount = names_.size();
+        }
+        std::lock_guard<std::mutex> lock(histMutex_);
+        clearBase_.assign(nameCount, LatencyHistogram());
+        for (const auto& entry : histograms_) {
+            if (entry.name_id < nameCount) clearBase_[entry.name_id].merge(*entry.hist);
+        }
+    }
+    for (uint32_t i = 0; i < gaugeCount_.load(std::memory_order_acquire); ++i) {
+        gauges_[i].last = 0;
+        gauges_[i].max = 0;
+        gauges_[i].sum = 0;
+        gauges_[i].samples = 0;
+    }
+    std::lock_guard<std::mutex> lock(snapMutex_);
+    snapshots_.clear();
 }
 
-} // namespace jts
\ No newline at end of file
+} // namespace jts
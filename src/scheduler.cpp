@@ -1,17 +1,411 @@
 #include "scheduler.hpp"
-#include <iostream>
+#include "cpu_utils.hpp"
+#include "logger.hpp"
+#include "metrics.hpp"
+#include "topology.hpp"
+#include "trace.hpp"
 #include <algorithm>
+#include <climits>
+#include <cmath>
 
 namespace jts {
 
-Scheduler::Scheduler() = default;
+Scheduler::Scheduler() {
+    buildAdmissionBins();
+}
+
+Scheduler::Scheduler(size_t numWorkers) {
+    if (numWorkers == 0) {
+        numWorkers = Topology::system().size();
+    }
+    addWorkers(TaskType::CPU, numWorkers, true, {});
+    buildAdmissionBins();
+}
+
+Scheduler::Scheduler(const SchedulerOptions& options)
+    : metrics_(options.metrics), admission_(options.admission) {
+    const size_t cpus = Topology::system().size();
+    addWorkers(TaskType::CPU, options.cpu.workers ? options.cpu.workers : cpus,
+               options.cpu.pin, options.cpu.cores);
+    if (!options.io.disabled) {
+        // Fazla abonelik: bloklanan IO görevleri çekirdek tutmaz
+        addWorkers(TaskType::IO, options.io.workers ? options.io.workers : 2 * cpus,
+                   options.io.pin, options.io.cores);
+    }
+    if (!options.gpu.disabled) {
+        addWorkers(TaskType::GPU, options.gpu.workers ? options.gpu.workers : 1,
+                   options.gpu.pin, options.gpu.cores);
+    }
+
+    if (metrics_) {
+        for (TaskType type : {TaskType::CPU, TaskType::GPU, TaskType::IO}) {
+            Domain& d = domainOf(type);
+            if (d.workers.empty()) continue;
+            std::string name = std::string("domain.") + taskTypeToString(type);
+            d.nameId = metrics_->internName(name);
+            d.gaugeId = metrics_->registerGauge(name + ".queue");
+        }
+    }
+    buildAdmissionBins();
+}
+
+void Scheduler::addWorkers(TaskType type, size_t count, bool pin, const std::vector<int>& cores) {
+    // Aynı cache'i paylaşan çekirdekler art arda, izole CPU'lar en sonda
+    std::vector<int> placement = cores;
+    if (pin && placement.empty()) {
+        placement = Topology::system().placement(count);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        auto worker = std::make_unique<Worker>();
+        worker->domain = type;
+        if (pin) {
+            worker->core = placement.empty() ? 0 : placement[i % placement.size()];
+        } else {
+            worker->core = -1;
+            worker->allowed = cores;
+        }
+        domainOf(type).workers.push_back(worker.get());
+        workers_.push_back(std::move(worker));
+    }
+}
 
 Scheduler::~Scheduler() {
     stop();
+    // registry_ kabul üyelerinden sonra yok edilir; clear() onlara dokunmasın
+    registry_.setReleaseHook(nullptr);
 }
 
 uint64_t Scheduler::addTask(Task task) {
-    return registry_.registerTask(task);
+    return addTask(std::move(task), nullptr);
+}
+
+uint64_t Scheduler::addTask(Task task, TaskFunction work) {
+    Reservation reservation;
+    if (!CpuMask::representable(task.cpu_cores) || !admit(task, reservation)) return 0;
+
+    // İlk aktivasyon: şimdi + faz (periyodik görevler buradan itibaren sayılır)
+    auto now = std::chrono::steady_clock::now();
+    auto release = now + task.phase;
+    task.release_time = release;
+    uint64_t id = registry_.registerTask(std::move(task), std::move(work));
+    bindReservation(id, reservation);
+    if (release > now) {
+        armTimer(release);
+    } else {
+        notifyWorker();
+    }
+    return id;
+}
+
+std::vector<uint64_t> Scheduler::addTasks(std::vector<Task> tasks) {
+    if (tasks.empty()) return {};
+
+    // Kabul edilmeyenler listeden çıkar, ID'leri 0 kalır
+    std::vector<Reservation> reservations(tasks.size());
+    std::vector<size_t> slots;
+    size_t kept = 0;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (!CpuMask::representable(tasks[i].cpu_cores) || !admit(tasks[i], reservations[kept])) {
+            continue;
+        }
+        if (kept != i) tasks[kept] = std::move(tasks[i]);
+        slots.push_back(i);
+        kept++;
+    }
+    size_t total = tasks.size();
+    tasks.resize(kept);
+
+    auto now = std::chrono::steady_clock::now();
+    auto earliest = std::chrono::steady_clock::time_point::max();
+    for (auto& task : tasks) {
+        task.release_time = now + task.phase;
+        if (task.release_time > now && task.release_time < earliest) {
+            earliest = task.release_time;
+        }
+    }
+    std::vector<uint64_t> registered = registry_.registerTasks(std::move(tasks));
+    std::vector<uint64_t> ids(total, 0);
+    for (size_t i = 0; i < registered.size(); ++i) {
+        ids[slots[i]] = registered[i];
+        bindReservation(registered[i], reservations[i]);
+    }
+    if (registered.empty()) return ids;
+    notifyWorker();  // Tek uyandırma: dağıtıcı/worker hazır görevleri art arda alır
+    if (earliest != std::chrono::steady_clock::time_point::max()) armTimer(earliest);
+    return ids;
+}
+
+uint64_t Scheduler::addTaskAt(Task task, std::chrono::steady_clock::time_point when) {
+    return addTaskAt(std::move(task), nullptr, when);
+}
+
+uint64_t Scheduler::addTaskAt(Task task, TaskFunction work,
+                              std::chrono::steady_clock::time_point when) {
+    Reservation reservation;
+    if (!CpuMask::representable(task.cpu_cores) || !admit(task, reservation)) return 0;
+
+    task.release_time = when;
+    uint64_t id = registry_.registerTask(std::move(task), std::move(work));
+    bindReservation(id, reservation);
+    if (when > std::chrono::steady_clock::now()) {
+        armTimer(when);
+    } else {
+        notifyWorker();
+    }
+    return id;
+}
+
+uint64_t Scheduler::addTaskAfter(Task task, std::chrono::steady_clock::duration delay) {
+    return addTaskAt(std::move(task), nullptr, std::chrono::steady_clock::now() + delay);
+}
+
+uint64_t Scheduler::addTaskAfter(Task task, TaskFunction work,
+                                 std::chrono::steady_clock::duration delay) {
+    return addTaskAt(std::move(task), std::move(work), std::chrono::steady_clock::now() + delay);
+}
+
+bool Scheduler::cancelTask(uint64_t id) {
+    if (!registry_.removeTask(id)) return false;  // Pay registry kancasıyla geri verilir
+    notifyDone();
+    return true;
+}
+
+void Scheduler::setAdmission(const AdmissionOptions& options) {
+    std::lock_guard<std::mutex> lock(admissionMutex_);
+    admission_ = options;
+}
+
+void Scheduler::buildAdmissionBins() {
+    // Görev hangi yoldan çıkarsa çıksın (cancelTask, registry().removeTask(),
+    // clear(), çalışırken iptal) payı geri verilir
+    registry_.setReleaseHook([this](uint64_t id) { releaseReservation(id); });
+
+    if (workers_.empty()) {
+        bins_.push_back(AdmissionBin{});  // Tek thread: tek işlemci
+        return;
+    }
+    // Sabitli worker: çekirdek başına kutu (aynı çekirdekteki worker'lar
+    // işlemci eklemez); sabitlenmemiş worker'lar alan başına tek küresel kutu
+    for (const auto& w : workers_) {
+        auto same = std::find_if(bins_.begin(), bins_.end(), [&w](const AdmissionBin& b) {
+            return b.domain == w->domain && b.core == w->core;
+        });
+        if (same == bins_.end()) {
+            AdmissionBin bin;
+            bin.domain = w->domain;
+            bin.core = w->core;
+            bins_.push_back(bin);
+        } else if (w->core < 0) {
+            same->processors++;
+        }
+    }
+}
+
+bool Scheduler::fits(const AdmissionBin& bin, double share, double maxShare) const {
+    constexpr double kEpsilon = 1e-9;  // Tam dolu çekirdek (U = 1.0) kabul edilsin
+    const double capacity = admission_.capacity;
+    if (share > capacity + kEpsilon) return false;
+    double total = bin.utilization + share;
+
+    if (bin.processors > 1) {
+        // Küresel EDF (Goossens-Funk-Baruah): U <= m - (m - 1) * u_max
+        double m = static_cast<double>(bin.processors);
+        double umax = std::max(maxShare, share);
+        return total <= capacity * (m - (m - 1.0) * umax) + kEpsilon;
+    }
+    if (admission_.policy == AdmissionPolicy::RateMonotonic) {
+        // Liu-Layland: U <= n (2^(1/n) - 1)
+        double n = static_cast<double>(bin.tasks + 1);
+        return total <= capacity * n * (std::pow(2.0, 1.0 / n) - 1.0) + kEpsilon;
+    }
+    return total <= capacity + kEpsilon;
+}
+
+bool Scheduler::admit(Task& task, Reservation& reservation) {
+    reservation.bin = SIZE_MAX;
+    reservation.share = 0.0;
+
+    std::lock_guard<std::mutex> lock(admissionMutex_);
+    if (admission_.policy == AdmissionPolicy::None || !task.isPeriodic() ||
+        task.wcet.count() <= 0) {
+        return true;  // Sınanmaz, pay ayırmaz
+    }
+
+    auto relative = task.deadline.count() > 0 ? std::min(task.deadline, task.period)
+                                              : task.period;
+    double share = static_cast<double>(task.wcet.count()) /
+                   static_cast<double>(relative.count());
+
+    // Adaylar pickWorker() ile aynı: türün alanı (yoksa CPU), cpu_cores'a
+    // uyan çekirdekler; hiçbiri uymuyorsa alanın tüm kutuları
+    TaskType domain = task.type;
+    if (!workers_.empty() && domainOf(domain).workers.empty()) domain = TaskType::CPU;
+    CpuMask cores = CpuMask::fromCores(task.cpu_cores);
+    auto inDomain = [this, domain](const AdmissionBin& b) {
+        return workers_.empty() || b.domain == domain;
+    };
+    bool anyMatch = false;
+    for (const AdmissionBin& b : bins_) {
+        if (inDomain(b) && (cores.empty() || b.core < 0 || cores.test(b.core))) anyMatch = true;
+    }
+
+    // En boş (worst-fit) ve sınavı geçen kutu: yük çekirdeklere yayılır
+    size_t best = SIZE_MAX;
+    for (size_t i = 0; i < bins_.size(); ++i) {
+        const AdmissionBin& b = bins_[i];
+        if (!inDomain(b)) continue;
+        if (anyMatch && !cores.empty() && b.core >= 0 && !cores.test(b.core)) continue;
+
+        double maxShare = 0.0;
+        if (b.processors > 1) {
+            for (const auto& r : reservations_) {
+                if (r.second.bin == i) maxShare = std::max(maxShare, r.second.share);
+            }
+        }
+        if (!fits(b, share, maxShare)) continue;
+        double load = b.utilization / static_cast<double>(b.processors);
+        if (best == SIZE_MAX ||
+            load < bins_[best].utilization / static_cast<double>(bins_[best].processors)) {
+            best = i;
+        }
+    }
+
+    if (best != SIZE_MAX) {
+        AdmissionBin& bin = bins_[best];
+        bin.utilization += share;
+        bin.tasks++;
+        admitted_++;
+        if (bin.core >= 0) task.cpu_cores = {bin.core};  // Bölümlenmiş: çekirdeğinde kalır
+        reservation.bin = best;
+        reservation.share = share;
+        return true;
+    }
+
+    if (admission_.onFail == AdmissionAction::Reject) {
+        rejected_++;
+        JTS_LOG_WARN("[Scheduler] Kabul edilmedi: %s (wcet=%lldus, period=%lldus, pay=%.3f)",
+                     task.name.c_str(), static_cast<long long>(task.wcet.count()),
+                     static_cast<long long>(task.period.count()), share);
+        return false;
+    }
+    demoted_++;
+    task.realtime = false;
+    task.priority = std::min(task.priority, admission_.demotedPriority);
+    JTS_LOG_WARN("[Scheduler] Düşürüldü: %s (pay=%.3f) -> pri=%d, realtime değil",
+                 task.name.c_str(), share, task.priority);
+    return true;
+}
+
+void Scheduler::bindReservation(uint64_t id, const Reservation& reservation) {
+    if (reservation.bin == SIZE_MAX) return;
+    {
+        std::lock_guard<std::mutex> lock(admissionMutex_);
+        reservations_[id] = reservation;
+    }
+    // Kayıtla bağlama arasında silindiyse kanca payı bulamamıştır.
+    // Kilit dışında: kanca registry -> admissionMutex_ sırasıyla kilitler
+    if (!registry_.contains(id)) releaseReservation(id);
+}
+
+void Scheduler::releaseReservation(uint64_t id) {
+    std::lock_guard<std::mutex> lock(admissionMutex_);
+    auto it = reservations_.find(id);
+    if (it == reservations_.end()) return;
+    AdmissionBin& bin = bins_[it->second.bin];
+    bin.tasks--;
+    // Kayan nokta artığı birikmesin
+    bin.utilization = bin.tasks == 0 ? 0.0 : std::max(0.0, bin.utilization - it->second.share);
+    reservations_.erase(it);
+}
+
+AdmissionStats Scheduler::admissionStats() const {
+    std::lock_guard<std::mutex> lock(admissionMutex_);
+    AdmissionStats stats;
+    stats.admitted = admitted_;
+    stats.rejected = rejected_;
+    stats.demoted = demoted_;
+    stats.budget_overruns = budgetOverruns_.load();
+    return stats;
+}
+
+double Scheduler::reservedUtilization(int core) const {
+    std::lock_guard<std::mutex> lock(admissionMutex_);
+    double total = 0.0;
+    for (const AdmissionBin& b : bins_) {
+        if (b.core == core) total += b.utilization;
+    }
+    return total;
+}
+
+void Scheduler::notifyDone() {
+    // registry_'ye yazma ile doneWaiters_ okuması yer değiştirmesin
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (doneWaiters_.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        doneCv_.notify_all();
+    }
+}
+
+template <typename Pred>
+bool Scheduler::waitUntil(Pred done, const std::chrono::steady_clock::time_point* deadline) {
+    if (!running_) {
+        // Yürütücü yok: görevleri bu thread'de çalıştır
+        while (!done()) {
+            if (deadline && std::chrono::steady_clock::now() >= *deadline) return false;
+            if (executeNextTask()) continue;
+            auto next = registry_.nextRelease();
+            if (!next) return done();  // İlerleyecek görev yok
+            std::this_thread::sleep_until(deadline && *deadline < *next ? *deadline : *next);
+        }
+        return true;
+    }
+
+    doneWaiters_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bool ok = true;
+    {
+        std::unique_lock<std::mutex> lock(doneMutex_);
+        if (deadline) {
+            ok = doneCv_.wait_until(lock, *deadline, done);
+        } else {
+            doneCv_.wait(lock, done);
+        }
+    }
+    doneWaiters_.fetch_sub(1);
+    return ok;
+}
+
+void Scheduler::wait(uint64_t id) {
+    waitUntil([this, id]() { return !registry_.contains(id); }, nullptr);
+}
+
+void Scheduler::wait(const std::vector<uint64_t>& ids) {
+    // Bitenler atlanır: her uyanışta sadece kalanlardan ilki kontrol edilir
+    size_t next = 0;
+    waitUntil([this, &ids, &next]() {
+        while (next < ids.size() && !registry_.contains(ids[next])) ++next;
+        return next == ids.size();
+    }, nullptr);
+}
+
+bool Scheduler::waitFor(const std::vector<uint64_t>& ids, std::chrono::milliseconds timeout) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    size_t next = 0;
+    return waitUntil([this, &ids, &next]() {
+        while (next < ids.size() && !registry_.contains(ids[next])) ++next;
+        return next == ids.size();
+    }, &deadline);
+}
+
+void Scheduler::waitIdle() {
+    // İptal edilmiş ama worker kuyruğunda duran görevler de beklenir
+    waitUntil([this]() {
+        if (registry_.activeCount() != 0) return false;
+        for (const auto& w : workers_) {
+            if (w->load.load() != 0) return false;
+        }
+        return true;
+    }, nullptr);
 }
 
 bool Scheduler::runOnce() {
@@ -22,23 +416,145 @@ void Scheduler::start() {
     if (running_) return;
     
     running_ = true;
+
+    if (!workers_.empty()) {
+        // Çoklu worker modu: önce worker'lar, sonra dağıtıcı
+        for (auto& w : workers_) {
+            {
+                std::lock_guard<std::mutex> lock(w->mutex);
+                w->stop = false;
+            }
+            Worker& worker = *w;
+            w->thread = std::thread([this, &worker]() { workerLoop(worker); });
+            if (w->core >= 0) {
+                setThreadAffinity(w->thread, {w->core});
+            } else if (!w->allowed.empty()) {
+                setThreadAffinity(w->thread, w->allowed);
+            }
+        }
+        workerThread_ = std::thread([this]() { dispatchLoop(); });
+        timerThread_ = std::thread([this]() { timerLoop(); });
+        return;
+    }
+
+    timerThread_ = std::thread([this]() { timerLoop(); });
+
     workerThread_ = std::thread([this]() {
-        std::cout << "[Scheduler] Başlatıldı\n";
+        JTS_LOG_INFO("[Scheduler] Başlatıldı");
         while (running_) {
             if (!executeNextTask()) {
-                // Çalıştırılacak task yok, bekle
-                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                waitForWork();
             }
         }
-        std::cout << "[Scheduler] Durduruldu\n";
+        JTS_LOG_INFO("[Scheduler] Durduruldu");
     });
 }
 
 void Scheduler::stop() {
-    running_ = false;
+    {
+        // Bayrak kilit altında değişmeli, yoksa worker koşulu kontrol edip
+        // wait()'e girmeden önce gelen bildirim kaybolabilir
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        running_ = false;
+    }
+    wakeCv_.notify_all();
+    kickTimer();
+    if (timerThread_.joinable()) {
+        timerThread_.join();
+    }
     if (workerThread_.joinable()) {
         workerThread_.join();
     }
+
+    // Dağıtıcı durduktan sonra worker'lar kuyruklarını bitirip çıkar
+    for (auto& w : workers_) {
+        {
+            std::lock_guard<std::mutex> lock(w->mutex);
+            w->stop = true;
+        }
+        w->cv.notify_all();
+    }
+    for (auto& w : workers_) {
+        if (w->thread.joinable()) {
+            w->thread.join();
+        }
+    }
+}
+
+void Scheduler::notifyWorker() {
+    // wakeGen_ kilit altında artar: worker ya koşulu henüz kontrol etmedi
+    // (değişikliği görecek) ya da zaten wait() içinde (bildirimi alacak)
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        ++wakeGen_;
+    }
+    wakeCv_.notify_one();
+}
+
+void Scheduler::waitForWork() {
+    std::unique_lock<std::mutex> lock(wakeMutex_);
+    uint64_t seenGen = wakeGen_;
+
+    // Hazır görev yok: yeni görev gelene veya zamanlayıcı thread'i
+    // aktivasyonu gelen görevi hazır kümeye taşıyana kadar uyu
+    wakeCv_.wait(lock, [this, seenGen]() {
+        return !running_ || wakeGen_ != seenGen || registry_.readyCount() > 0;
+    });
+}
+
+void Scheduler::timerLoop() {
+    while (true) {
+        // Hesaplama sırasında gelen her ekleme uyandırsın (hedef bilinmiyor)
+        timerTarget_.store(INT64_MAX);
+        uint32_t seen = timerWord_.load();
+        if (!running_) break;
+
+        if (registry_.releaseDue() > 0) {
+            notifyWorker();
+        }
+
+        // Tekerleğin en yakın anına kadar mutlak zamanlı uyu; bu arada daha
+        // erken bir görev eklenirse timerWord_ değişir ve bekleme biter
+        auto next = registry_.nextRelease();
+        int64_t deadline = -1;
+        if (next) {
+            deadline = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                next->time_since_epoch()).count();
+            timerTarget_.store(deadline);
+        }
+        detail::futexWaitUntil(timerWord_, seen, deadline);
+    }
+}
+
+void Scheduler::armTimer(std::chrono::steady_clock::time_point release) {
+    int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        release.time_since_epoch()).count();
+    if (ns < timerTarget_.load()) {
+        kickTimer();
+    }
+}
+
+void Scheduler::kickTimer() {
+    timerWord_.fetch_add(1);
+    detail::futexWakeAll(timerWord_);
+}
+
+uint64_t Scheduler::deadlineMisses() const {
+    return deadlineMisses_;
+}
+
+DomainStats Scheduler::domainStats(TaskType type) const {
+    const Domain& d = domains_[static_cast<size_t>(type)];
+    DomainStats stats;
+    stats.type = type;
+    stats.workers = d.workers.size();
+    stats.executed = d.executed.load();
+    stats.deadline_misses = d.misses.load();
+    stats.budget_overruns = d.overruns.load();
+    stats.queued = d.queued.load();
+    stats.max_queued = d.maxQueued.load();
+    stats.busy_ms = static_cast<double>(d.busyNs.load()) / 1e6;
+    return stats;
 }
 
 bool Scheduler::isRunning() const {
@@ -46,7 +562,16 @@ bool Scheduler::isRunning() const {
 }
 
 size_t Scheduler::pendingCount() const {
-    return registry_.count();
+    size_t total = registry_.count();
+    for (const auto& w : workers_) {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        total += w->queue.size() - w->queueHead;
+    }
+    return total;
+}
+
+size_t Scheduler::workerCount() const {
+    return workers_.size();
 }
 
 TaskRegistry& Scheduler::registry() {
@@ -54,38 +579,176 @@ TaskRegistry& Scheduler::registry() {
 }
 
 bool Scheduler::executeNextTask() {
-    auto tasks = registry_.listTasks();
-    if (tasks.empty()) return false;
-
-    // En yüksek öncelikli task'ı bul
-    auto maxIt = std::max_element(tasks.begin(), tasks.end(),
-        [](const Task& a, const Task& b) {
-            // Önce realtime kontrol
-            if (a.realtime != b.realtime) return b.realtime;
-            // Sonra priority
-            return a.priority < b.priority;
-        });
+    // En yüksek öncelikli task'ı ödünç al (tek kilit, O(log n), kopya yok)
+    ScheduledTask* task = registry_.acquireNext();
+    if (!task) return false;
 
-    if (maxIt == tasks.end()) return false;
+    JTS_TRACE(TraceEvent::Dispatch, task->id, task->name);
+    runTask(*task);
+    return true;
+}
 
-    Task task = *maxIt;
-    
-    // Task'ı sil (çalıştırılıyor)
-    registry_.removeTask(task.id);
+Scheduler::RunOutcome Scheduler::runTask(ScheduledTask& task) {
+    // Log (Debug: varsayılan seviyede biçimlendirme bile yapılmaz)
+    JTS_LOG_DEBUG("[Scheduler] Çalıştırılıyor: [%llu] %s (pri=%d)",
+                  static_cast<unsigned long long>(task.id), task.name, task.priority);
 
-    // Log
-    std::cout << "[Scheduler] Çalıştırılıyor: " << task.summary() << "\n";
+    RunOutcome outcome;
+    ActivationResult result;
 
     // Çalıştır
     if (task.work) {
         auto start = std::chrono::steady_clock::now();
+        JTS_TRACE(TraceEvent::Start, task.id, task.name);
         task.work();
+        JTS_TRACE(TraceEvent::End, task.id, task.name);
         auto end = std::chrono::steady_clock::now();
         auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        std::cout << "[Scheduler] Tamamlandı: " << task.name << " (" << ms << "ms)\n";
+        JTS_LOG_DEBUG("[Scheduler] Tamamlandı: %s (%lldms)", task.name,
+                      static_cast<long long>(ms));
+
+        // Bütçe: ölçülen süre bildirilen wcet'ten uzunsa aşım (uyarı bir kez).
+        // Sayaçlar burada değil complete()'te, registry kilidi altında yazılır;
+        // okumak güvenli (çalışan aktivasyonun tek yazıcısı bu thread)
+        result.runtime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+        if (task.wcet.count() > 0 && end - start > task.wcet) {
+            outcome.overrun = result.overrun = true;
+            budgetOverruns_++;
+            if (task.budget_overruns == 0) {
+                JTS_LOG_WARN("[Scheduler] Bütçe aşımı: %s %lldus > wcet %lldus", task.name,
+                             static_cast<long long>(result.runtime.count()),
+                             static_cast<long long>(task.wcet.count()));
+            }
+        }
     }
 
-    return true;
+    // Son tarih kontrolü: bitiş anı mutlak son tarihten sonraysa kaçırıldı
+    outcome.missed = result.missed = std::chrono::steady_clock::now() > task.absoluteDeadline();
+    if (outcome.missed) deadlineMisses_++;
+
+    // Periyodik görev: complete() bir sonraki aktivasyona yeniden kurar
+    // (kaymasız: önceki aktivasyon + periyot). Tek seferlik görev havuza döner.
+    // complete()'ten sonra task'a dokunulmaz: sonraki aktivasyon önceden hesaplanır
+    auto release = task.release_time;
+    if (task.isPeriodic()) release += task.period;
+    if (registry_.complete(&task, result)) {
+        if (release > std::chrono::steady_clock::now()) {
+            armTimer(release);  // Tekerlekte bekliyor
+        } else {
+            notifyWorker();
+        }
+    } else {
+        notifyDone();
+    }
+    return outcome;
+}
+
+void Scheduler::dispatchLoop() {
+    JTS_LOG_INFO("[Scheduler] %zu worker ile başlatıldı", workers_.size());
+    while (running_) {
+        ScheduledTask* next = registry_.acquireNext();
+        if (!next) {
+            waitForWork();
+            continue;
+        }
+
+        Worker& worker = pickWorker(*next);
+        JTS_TRACE_ARG(TraceEvent::Dispatch, next->id, next->name, worker.core);
+        Domain& domain = domainOf(worker.domain);
+        size_t queued = domain.queued.fetch_add(1) + 1;
+        size_t peak = domain.maxQueued.load(std::memory_order_relaxed);
+        while (queued > peak && !domain.maxQueued.compare_exchange_weak(peak, queued)) {}
+        if (metrics_) metrics_->setGauge(domain.gaugeId, static_cast<int64_t>(queued));
+        worker.load++;
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            worker.queue.push_back(next);
+        }
+        worker.cv.notify_one();
+    }
+    JTS_LOG_INFO("[Scheduler] Durduruldu");
+}
+
+void Scheduler::workerLoop(Worker& worker) {
+    while (true) {
+        ScheduledTask* task;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.cv.wait(lock, [&worker]() {
+                return worker.stop || worker.queueHead < worker.queue.size();
+            });
+            if (worker.queueHead == worker.queue.size()) return;  // stop ve kuyruk boş
+
+            task = worker.queue[worker.queueHead++];
+            if (worker.queueHead == worker.queue.size()) {
+                worker.queue.clear();  // Kapasite korunur
+                worker.queueHead = 0;
+            }
+        }
+
+        // Realtime görev SCHED_FIFO'da, diğerleri SCHED_OTHER'da çalışır
+        // (sabitlenmiş çekirdeği realtime olmayan iş aç bırakmasın). Politika
+        // yalnız geçişte değişir; yetki yoksa yükseltme bir daha denenmez.
+        if (task->realtime && !worker.fifo && !worker.realtimeDenied) {
+            worker.fifo = setRealtimeScheduling();
+            worker.realtimeDenied = !worker.fifo;
+        } else if (!task->realtime && worker.fifo) {
+            worker.fifo = !setNormalScheduling();
+        }
+
+        Domain& domain = domainOf(worker.domain);
+        size_t queued = domain.queued.fetch_sub(1) - 1;
+        if (metrics_) metrics_->setGauge(domain.gaugeId, static_cast<int64_t>(queued));
+
+        // runTask() sonrası task'a dokunulmaz: ölçüm id ve alan üzerinden
+        auto start = std::chrono::steady_clock::now();
+        MetricsToken token{};
+        if (metrics_) token = metrics_->recordStart(task->id, domain.nameId);
+        RunOutcome outcome = runTask(*task);
+        if (metrics_) metrics_->recordEnd(token, !outcome.missed);
+        domain.busyNs += std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        domain.executed++;
+        if (outcome.missed) domain.misses++;
+        if (outcome.overrun) domain.overruns++;
+        worker.load--;
+        notifyDone();  // waitIdle() worker yükünü de kontrol eder
+    }
+}
+
+Scheduler::Worker& Scheduler::pickWorker(const ScheduledTask& task) {
+    // Türün alanı yoksa (Scheduler(n) veya kapatılmış alan) CPU alanı
+    const std::vector<Worker*>* candidates = &domainOf(task.type).workers;
+    if (candidates->empty()) candidates = &domainOf(TaskType::CPU).workers;
+
+    Worker* best = nullptr;
+    for (Worker* w : *candidates) {
+        if (!task.cores.empty() && !task.cores.test(w->core)) {
+            continue;  // Bu worker görevin çekirdek kümesinde değil
+        }
+        if (!best || w->load < best->load) best = w;
+    }
+
+    // Tam eşleşme yoksa istenen çekirdeklerle cache paylaşan bir worker
+    if (!best) {
+        const Topology& topo = Topology::system();
+        for (Worker* w : *candidates) {
+            bool near = false;
+            for (int core = 0; core < CpuMask::kMaxCores && !near; ++core) {
+                near = task.cores.test(core) && topo.sameCacheGroup(core, w->core);
+            }
+            if (near && (!best || w->load < best->load)) best = w;
+        }
+    }
+
+    // Uygun çekirdek yoksa (ör. kartta olmayan çekirdek, sabitlenmemiş
+    // alan) alandaki herhangi bir worker
+    if (!best) {
+        for (Worker* w : *candidates) {
+            if (!best || w->load < best->load) best = w;
+        }
+    }
+    return *best;
 }
 
 } // namespace jts
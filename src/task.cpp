@@ -11,11 +11,16 @@
  * - serialize(): JSON formatına çevirme
  * - summary(): Özet metin oluşturma
  * - isValid(): Geçerlilik kontrolü
+ * - CpuMask, görev adı tablosu ve ScheduledTask dönüşümleri
  * ============================================================================
  */
 
 #include "task.hpp"    // Task yapısının tanımları
+#include "topology.hpp" // Topology - çevrimiçi çekirdek kontrolü
 #include <sstream>     // std::ostringstream - metin akışı oluşturmak için
+#include <deque>       // std::deque - ad tablosu (elemanların adresi kararlı)
+#include <mutex>       // std::mutex - ad tablosu kilidi
+#include <unordered_map> // std::unordered_map - ad -> ID
 
 namespace jts {
 
@@ -37,6 +42,15 @@ Task::Task()
     , realtime(false)    // Gerçek zamanlı değil
     , cpu_cores{}        // Boş çekirdek listesi
     , work(nullptr)      // Henüz iş fonksiyonu yok
+    , period(0)          // Tek seferlik
+    , deadline(0)        // Son tarih yok
+    , phase(0)           // Gecikme yok
+    , wcet(0)            // Bütçe bildirilmedi
+    , release_time{}     // Scheduler atayacak
+    , activations(0)
+    , deadline_misses(0)
+    , budget_overruns(0)
+    , max_runtime(0)
 {}
 
 /**
@@ -58,6 +72,15 @@ Task::Task(uint64_t id, const std::string& name, TaskType type, int priority)
     , realtime(false)    // Varsayılan: gerçek zamanlı değil
     , cpu_cores{}        // Varsayılan: boş liste
     , work(nullptr)      // Varsayılan: iş fonksiyonu yok
+    , period(0)
+    , deadline(0)
+    , phase(0)
+    , wcet(0)
+    , release_time{}
+    , activations(0)
+    , deadline_misses(0)
+    , budget_overruns(0)
+    , max_runtime(0)
 {}
 
 /**
@@ -86,6 +109,9 @@ std::string Task::serialize() const {
     oss << "\"type\":\"" << taskTypeToString(type) << "\",";
     oss << "\"priority\":" << priority << ",";
     oss << "\"realtime\":" << (realtime ? "true" : "false") << ",";
+    oss << "\"period_us\":" << period.count() << ",";
+    oss << "\"deadline_us\":" << deadline.count() << ",";
+    oss << "\"wcet_us\":" << wcet.count() << ",";
     
     // cpu_cores dizisini JSON dizisi olarak yaz
     oss << "\"cpu_cores\":[";
@@ -119,6 +145,9 @@ std::string Task::summary() const {
     
     // Gerçek zamanlı ise etiket ekle
     if (realtime) oss << " | REALTIME";
+
+    // Periyodik ise periyodu ekle
+    if (isPeriodic()) oss << " | period=" << period.count() << "us";
     
     return oss.str();
 }
@@ -132,11 +161,22 @@ std::string Task::summary() const {
  * KONTROL EDİLEN KURALLAR:
  * 1. Öncelik 0-10 arasında olmalı
  * 2. İsim boş olmamalı
- * 3. CPU çekirdek numaraları 0-5 arasında olmalı (Jetson sınırı)
+ * 3. CPU çekirdekleri bu sistemde çevrimiçi olmalı (Topology'den okunur;
+ *    eskiden Jetson'a özel 0-5 aralığı sabit yazılıydı) ve CpuMask
+ *    sınırının (64) altında kalmalı
+ * 4. Zaman alanları negatif olmamalı; bildirilen wcet göreli son tarihi
+ *    (yoksa periyodu) aşmamalı (her aktivasyon son tarihini kaçırırdı)
+ *
+ * Parametresiz biçim canlı sistemin topolojisini kullanır; diğeri hedef
+ * kartın topolojisine (ör. fixture ağacından okunmuş) göre doğrulamak için.
  * 
  * @return true: Tüm kurallar sağlanıyor, false: En az bir kural ihlali var
  */
 bool Task::isValid() const {
+    return isValid(Topology::system());
+}
+
+bool Task::isValid(const Topology& topology) const {
     // Kural 1: Öncelik aralık kontrolü
     if (priority < 0 || priority > 10) return false;
     
@@ -145,10 +185,155 @@ bool Task::isValid() const {
     
     // Kural 3: Her çekirdek numarası geçerli aralıkta olmalı
     for (int core : cpu_cores) {
-        if (core < 0 || core > 5) return false;  // Jetson'da 6 çekirdek var (0-5)
+        if (core < 0 || core >= CpuMask::kMaxCores) return false;
+        if (!topology.online(core)) return false;  // Bu kartta böyle bir çekirdek yok
     }
+
+    // Kural 4: Periyot, son tarih ve faz negatif olamaz
+    if (period.count() < 0 || deadline.count() < 0 || phase.count() < 0) return false;
+    if (wcet.count() < 0) return false;
+    auto relative = deadline.count() > 0 ? deadline : period;
+    if (relative.count() > 0 && wcet > relative) return false;
     
     return true;  // Tüm kontrollerden geçti
 }
 
+/**
+ * ----------------------------------------------------------------------------
+ * Task::absoluteDeadline() - Mutlak Son Tarih
+ * ----------------------------------------------------------------------------
+ * release_time + deadline (deadline 0 ise period kullanılır).
+ * İkisi de 0 ise görevin son tarihi yoktur; EDF sıralamasında en sona
+ * düşmesi için time_point::max() döner.
+ */
+namespace {
+
+std::chrono::steady_clock::time_point absoluteDeadlineOf(
+        std::chrono::steady_clock::time_point release,
+        std::chrono::microseconds deadline, std::chrono::microseconds period) {
+    auto relative = deadline.count() > 0 ? deadline : period;
+    if (relative.count() == 0) {
+        return std::chrono::steady_clock::time_point::max();
+    }
+    return release + relative;
+}
+
+} // namespace
+
+std::chrono::steady_clock::time_point Task::absoluteDeadline() const {
+    return absoluteDeadlineOf(release_time, deadline, period);
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * CpuMask::fromCores() / toCores() - Vektör <-> Bit Maskesi
+ * ----------------------------------------------------------------------------
+ */
+CpuMask CpuMask::fromCores(const std::vector<int>& cores) {
+    CpuMask mask;
+    for (int core : cores) mask.set(core);
+    return mask;
+}
+
+std::vector<int> CpuMask::toCores() const {
+    std::vector<int> cores;
+    for (int core = 0; core < kMaxCores; ++core) {
+        if (test(core)) cores.push_back(core);
+    }
+    return cores;
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * internTaskName() / taskName() - Görev Adı Tablosu
+ * ----------------------------------------------------------------------------
+ * Adlar bir deque'de tutulur: push_back mevcut elemanların adresini
+ * değiştirmez, bu yüzden taskName()'in döndürdüğü c_str() işaretçisi
+ * program sonuna kadar geçerlidir. ScheduledTask işaretçiyi kayıtta bir
+ * kez alır; zamanlama yolunda (log, trace) tabloya hiç dokunulmaz.
+ */
+namespace {
+
+struct NameTable {
+    std::mutex mutex;
+    std::deque<std::string> names;
+    std::unordered_map<std::string, uint32_t> ids;
+};
+
+NameTable& nameTable() {
+    static NameTable table;
+    return table;
+}
+
+} // namespace
+
+uint32_t internTaskName(const std::string& name) {
+    NameTable& table = nameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.ids.find(name);
+    if (it != table.ids.end()) return it->second;
+
+    uint32_t id = static_cast<uint32_t>(table.names.size());
+    table.names.push_back(name);
+    table.ids.emplace(name, id);
+    return id;
+}
+
+const char* taskName(uint32_t nameId) {
+    NameTable& table = nameTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return nameId < table.names.size() ? table.names[nameId].c_str() : "";
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * ScheduledTask - Task Tanımından Dönüşüm
+ * ----------------------------------------------------------------------------
+ * Kayıtta bir kez çalışır: ad tabloya eklenir (aynı adla ikinci kayıtta
+ * kopya yok), çekirdek listesi maskeye çevrilir, iş fonksiyonu taşınır.
+ */
+ScheduledTask::ScheduledTask(Task&& task, TaskFunction fn)
+    : id(task.id)
+    , name_id(internTaskName(task.name))
+    , name(taskName(name_id))
+    , type(task.type)
+    , priority(task.priority)
+    , realtime(task.realtime)
+    , cores(CpuMask::fromCores(task.cpu_cores))
+    , work(std::move(fn))
+    , period(task.period)
+    , deadline(task.deadline)
+    , phase(task.phase)
+    , wcet(task.wcet)
+    , release_time(task.release_time)
+    , activations(task.activations)
+    , deadline_misses(task.deadline_misses)
+    , budget_overruns(task.budget_overruns)
+    , max_runtime(task.max_runtime)
+{
+    if (!work && task.work) {
+        work = TaskFunction(std::move(task.work));
+    }
+}
+
+std::chrono::steady_clock::time_point ScheduledTask::absoluteDeadline() const {
+    return absoluteDeadlineOf(release_time, deadline, period);
+}
+
+Task ScheduledTask::toTask() const {
+    Task task(id, name, type, priority);
+    task.realtime = realtime;
+    task.cpu_cores = cores.toCores();
+    task.period = period;
+    task.deadline = deadline;
+    task.phase = phase;
+    task.wcet = wcet;
+    task.release_time = release_time;
+    task.activations = activations;
+    task.deadline_misses = deadline_misses;
+    task.budget_overruns = budget_overruns;
+    task.max_runtime = max_runtime;
+    return task;
+}
+
 } // namespace jts
\ No newline at end of file
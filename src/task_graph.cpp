@@ -0,0 +1,180 @@
+#include "task_graph.hpp"
+#include "scheduler.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace jts {
+
+TaskGraph::NodeId TaskGraph::addNode(Task desc, TaskFunction work) {
+    auto node = std::make_unique<Node>();
+    node->desc = std::move(desc);
+    node->work = std::move(work);
+    nodes_.push_back(std::move(node));
+    return nodes_.size() - 1;
+}
+
+TaskGraph::NodeId TaskGraph::addNode(const std::string& name, TaskFunction work) {
+    Task desc;
+    desc.name = name;
+    return addNode(std::move(desc), std::move(work));
+}
+
+bool TaskGraph::reachable(NodeId from, NodeId to) const {
+    // Derinlik öncelikli arama (graf kurulumunda, sıcak yolda değil)
+    std::vector<bool> seen(nodes_.size(), false);
+    std::vector<NodeId> stack{from};
+    while (!stack.empty()) {
+        NodeId n = stack.back();
+        stack.pop_back();
+        if (n == to) return true;
+        if (seen[n]) continue;
+        seen[n] = true;
+        for (NodeId s : nodes_[n]->successors) stack.push_back(s);
+    }
+    return false;
+}
+
+bool TaskGraph::addEdge(NodeId from, NodeId to) {
+    if (from >= nodes_.size() || to >= nodes_.size() || from == to) return false;
+    if (running_) return false;
+
+    auto& succ = nodes_[from]->successors;
+    if (std::find(succ.begin(), succ.end(), to) != succ.end()) return false;
+    if (reachable(to, from)) return false;  // Döngü oluşurdu
+
+    succ.push_back(to);
+    nodes_[to]->predecessors++;
+    return true;
+}
+
+bool TaskGraph::execute(const std::function<void(NodeId)>& dispatch,
+                        const std::function<bool()>& driveInline) {
+    bool expected = false;
+    if (!running_.compare_exchange_strong(expected, true)) return false;
+
+    if (nodes_.empty()) {
+        running_ = false;
+        runs_++;
+        return true;
+    }
+
+    // Sayaçları sıfırla; kökler dağıtılmadan önce hepsi hazır olmalı
+    for (auto& node : nodes_) {
+        node->pending.store(node->predecessors, std::memory_order_relaxed);
+    }
+    remaining_.store(nodes_.size(), std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        done_ = false;
+        error_ = nullptr;
+    }
+    dispatch_ = &dispatch;
+
+    for (NodeId id = 0; id < nodes_.size(); ++id) {
+        if (nodes_[id]->predecessors == 0) dispatch(id);
+    }
+
+    bool ok = true;
+    if (driveInline) {
+        // Çalıştırıcı thread'i yok: görevleri bu thread'de yürüt
+        while (remaining_.load(std::memory_order_acquire) > 0) {
+            if (!driveInline()) {
+                // Registry boş: bu çalıştırmanın düğümü kalmadı (dışarıdan
+                // silindi); dispatch_'e dokunacak görev yok
+                ok = false;
+                break;
+            }
+        }
+    } else {
+        std::unique_lock<std::mutex> lock(doneMutex_);
+        doneCv_.wait(lock, [this]() { return done_; });
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        error = std::exchange(error_, nullptr);
+    }
+    dispatch_ = nullptr;
+    runs_++;
+    running_ = false;
+    if (error) std::rethrow_exception(error);
+    return ok;
+}
+
+void TaskGraph::runNode(NodeId id) {
+    Node& node = *nodes_[id];
+    if (node.work) {
+        // İstisna sayaçları atlatmamalı: yoksa remaining_ sıfırlanmaz ve
+        // run() sonsuza dek bekler. İlki saklanır, run()'da fırlatılır
+        try {
+            node.work();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(doneMutex_);
+            if (!error_) error_ = std::current_exception();
+        }
+    }
+    finishNode(id);
+}
+
+void TaskGraph::failNode(NodeId id) {
+    {
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        if (!error_) {
+            error_ = std::make_exception_ptr(std::runtime_error(
+                "TaskGraph: düğüm zamanlanamadı: " + nodes_[id]->desc.name));
+        }
+    }
+    finishNode(id);
+}
+
+void TaskGraph::finishNode(NodeId id) {
+    Node& node = *nodes_[id];
+
+    // acq_rel: bu düğümün yazdıkları ardılın work()'ünde görünür olmalı
+    for (NodeId s : node.successors) {
+        if (nodes_[s]->pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            (*dispatch_)(s);
+        }
+    }
+
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        // Bildirim kilit altında: run() dönüp graf yok edilse bile
+        // yok edilmiş cv'ye dokunulmaz
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        done_ = true;
+        doneCv_.notify_all();
+    }
+}
+
+bool TaskGraph::run(ThreadPool& pool) {
+    std::function<void(NodeId)> dispatch = [this, &pool](NodeId id) {
+        const Task& desc = nodes_[id]->desc;
+        pool.submit(desc.priority, desc.realtime, [this, id]() { runNode(id); });
+    };
+    return execute(dispatch);
+}
+
+bool TaskGraph::run(Scheduler& scheduler) {
+    std::function<void(NodeId)> dispatch = [this, &scheduler](NodeId id) {
+        if (scheduler.addTask(nodes_[id]->desc.oneShot(), [this, id]() { runNode(id); }) == 0) {
+            failNode(id);  // Reddedildi: bekleyen sayaç takılmasın
+        }
+    };
+    if (scheduler.isRunning()) {
+        return execute(dispatch);
+    }
+    return execute(dispatch, [&scheduler]() {
+        if (scheduler.runOnce()) return true;
+        // Henüz hazır değil (ör. başka kaynaktan gecikmeli görev): bekle
+        auto next = scheduler.registry().nextRelease();
+        if (!next) return false;
+        std::this_thread::sleep_until(*next);
+        return true;
+    });
+}
+
+} // namespace jts
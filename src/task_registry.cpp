@@ -10,14 +10,289 @@
  * - Her fonksiyon mutex ile korunur
  * - Birden fazla thread aynı anda erişse bile veri bozulmaz
  * - std::lock_guard otomatik kilit yönetimi sağlar
+ *
+ * VERİ YAPISI (İNDEKSLİ ÖNCELİK KUYRUĞU):
+ * - pool_:  ScheduledTask nesne havuzu, görev silinene kadar yer değiştirmez
+ * - heap_:  Hazır görevlerin paketlenmiş 64-bit sıralama anahtarları (4'lü
+ *           heap, sıcak dizi); heapTasks_ aynı konumdaki görev işaretçileri
+ * - wheel_: Aktivasyon anı gelmemiş görevler (hiyerarşik zamanlama tekerleği,
+ *           1 us tick; ekleme ve iptal O(1), görev kendi TimerLink'iyle bağlı)
+ * - index_: id -> görev hash tablosu (açık adresleme, allocation'sız)
+ * - Her görev kendi heap konumunu bilir, böylece id ile silme O(log n) olur
+ *   (tekerlekteki görev O(1) ile çıkar)
  * ============================================================================
  */
 
 #include "task_registry.hpp"  // Sınıf tanımları
-#include <algorithm>          // std::remove_if için - dizi elemanı silme
+#include "trace.hpp"          // JTS_TRACE - zaman çizelgesi olayları
+#include <algorithm>          // std::sort için - listeyi ID sırasına dizmek
+#include <memory>             // std::shared_ptr - popHighest() iş fonksiyonu köprüsü
 
 namespace jts {
 
+/**
+ * ----------------------------------------------------------------------------
+ * IdIndex - Açık Adreslemeli id -> Görev Tablosu
+ * ----------------------------------------------------------------------------
+ * Doluluk %50'yi geçince tablo iki katına büyür. Silmede mezar taşı
+ * kullanılmaz; ardından gelen zincir geri kaydırılır (backward shift),
+ * böylece arama süresi zamanla bozulmaz.
+ */
+size_t TaskRegistry::IdIndex::home(uint64_t id) const {
+    uint64_t h = id * 0x9E3779B97F4A7C15ull;  // Fibonacci hash
+    h ^= h >> 32;
+    return static_cast<size_t>(h) & (table_.size() - 1);
+}
+
+void TaskRegistry::IdIndex::rehash(size_t capacity) {
+    std::vector<Entry> old;
+    old.swap(table_);
+    table_.assign(capacity, Entry{0, nullptr});
+    size_ = 0;
+    for (const auto& e : old) {
+        if (e.id != 0) insert(e.id, e.task);
+    }
+}
+
+void TaskRegistry::IdIndex::reserve(size_t count) {
+    size_t capacity = 16;
+    while (capacity < count * 2) capacity <<= 1;
+    if (capacity > table_.size()) rehash(capacity);
+}
+
+ScheduledTask* TaskRegistry::IdIndex::find(uint64_t id) const {
+    if (table_.empty()) return nullptr;
+    const size_t mask = table_.size() - 1;
+    for (size_t i = home(id);; i = (i + 1) & mask) {
+        if (table_[i].id == id) return table_[i].task;
+        if (table_[i].id == 0) return nullptr;
+    }
+}
+
+void TaskRegistry::IdIndex::insert(uint64_t id, ScheduledTask* task) {
+    if ((size_ + 1) * 2 > table_.size()) {
+        rehash(table_.empty() ? 16 : table_.size() * 2);
+    }
+    const size_t mask = table_.size() - 1;
+    size_t i = home(id);
+    while (table_[i].id != 0 && table_[i].id != id) {
+        i = (i + 1) & mask;
+    }
+    if (table_[i].id == 0) ++size_;
+    table_[i] = Entry{id, task};
+}
+
+bool TaskRegistry::IdIndex::erase(uint64_t id) {
+    if (table_.empty()) return false;
+    const size_t mask = table_.size() - 1;
+    size_t i = home(id);
+    while (table_[i].id != id) {
+        if (table_[i].id == 0) return false;
+        i = (i + 1) & mask;
+    }
+
+    // i boşaldı; zincirde ev konumu i'ye "geçilmiş" elemanları geri çek
+    for (size_t j = (i + 1) & mask; table_[j].id != 0; j = (j + 1) & mask) {
+        size_t k = home(table_[j].id);
+        bool between = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+        if (!between) {
+            table_[i] = table_[j];
+            i = j;
+        }
+    }
+    table_[i] = Entry{0, nullptr};
+    --size_;
+    return true;
+}
+
+void TaskRegistry::IdIndex::clear() {
+    for (auto& e : table_) e = Entry{0, nullptr};
+    size_ = 0;
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * TaskRegistry() - Yapıcı
+ * ----------------------------------------------------------------------------
+ * Tekerlek şimdiki andan başlar: ilk kayıtlar yakın yuvalara düşer, sıfırdan
+ * başlasaydı ilk ilerlemede boş seviyeler boyunca cascade gerekirdi.
+ */
+TaskRegistry::TaskRegistry() : wheel_(toNs(Clock::now()) / 1000) {}
+
+/**
+ * ----------------------------------------------------------------------------
+ * ~TaskRegistry() - Havuzdaki Görevleri Serbest Bırak
+ * ----------------------------------------------------------------------------
+ * Ödünç alınmış görev kalmamalıdır (Scheduler durdurulmuş olmalı).
+ */
+TaskRegistry::~TaskRegistry() {
+    clear();
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * higher() - Öncelik Karşılaştırması
+ * ----------------------------------------------------------------------------
+ * a görevi b'den önce çalışmalıysa true döner.
+ *
+ * SIRALAMA KURALLARI:
+ * 1. Realtime görev, realtime olmayandan her zaman önce
+ * 2. Yüksek priority önce
+ * 3. Aynı bantta mutlak son tarihi erken olan önce (EDF)
+ * 4. Eşitlikte önce kaydedilen önce (FIFO)
+ *
+ * 1-3 packKey() ile tek bir 64-bit anahtara katlanır; karşılaştırma iki
+ * tamsayı karşılaştırmasından ibarettir (dallanmasız derlenebilir).
+ * Son tarih mikrosaniyeye yuvarlanır: aynı mikrosaniyedeki son tarihler
+ * FIFO ile ayrılır.
+ */
+uint64_t TaskRegistry::packKey(bool realtime, int priority, int64_t deadlineNs) {
+    constexpr int64_t kDeadlineMask = (int64_t(1) << 48) - 1;
+    int p = std::min(std::max(priority, -16384), 16383) + 16384;  // 0..32767
+    uint64_t band = (realtime ? 0u : 0x8000u) | static_cast<uint64_t>(32767 - p);
+    int64_t us = deadlineNs > 0 ? deadlineNs / 1000 : 0;
+    if (us > kDeadlineMask) us = kDeadlineMask;
+    return (band << 48) | static_cast<uint64_t>(us);
+}
+
+bool TaskRegistry::higher(const HeapEntry& a, const HeapEntry& b) {
+    return a.key < b.key || (a.key == b.key && a.seq < b.seq);
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * swapEntries() / siftUp() / siftDown() - Heap Yardımcıları
+ * ----------------------------------------------------------------------------
+ * 4'lü heap işlemleri: pos'un çocukları kArity*pos+1 .. kArity*pos+4,
+ * ebeveyni (pos-1)/kArity. Her yer değiştirmede anahtar ve görev
+ * dizileri birlikte değişir, görevlerin heapPos_ alanı güncellenir; indeks
+ * her zaman tutarlı kalır.
+ */
+void TaskRegistry::swapEntries(size_t a, size_t b) {
+    std::swap(heap_[a], heap_[b]);
+    std::swap(heapTasks_[a], heapTasks_[b]);
+    heapTasks_[a]->heapPos_ = a;
+    heapTasks_[b]->heapPos_ = b;
+}
+
+void TaskRegistry::siftUp(size_t pos) {
+    while (pos > 0) {
+        size_t parent = (pos - 1) / kArity;
+        if (!higher(heap_[pos], heap_[parent])) break;
+        swapEntries(pos, parent);
+        pos = parent;
+    }
+}
+
+void TaskRegistry::siftDown(size_t pos) {
+    const size_t n = heap_.size();
+    while (true) {
+        size_t first = kArity * pos + 1;
+        if (first >= n) break;
+        size_t last = std::min(first + kArity, n);
+
+        // Bitişik çocuklardan en iyisi: sadece sıcak diziye dokunur
+        size_t best = first;
+        for (size_t c = first + 1; c < last; ++c) {
+            if (higher(heap_[c], heap_[best])) best = c;
+        }
+        if (!higher(heap_[best], heap_[pos])) break;
+        swapEntries(pos, best);
+        pos = best;
+    }
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * eraseAt() - Heap'ten Eleman Sil
+ * ----------------------------------------------------------------------------
+ * heap_[pos]'taki görevi çıkarır:
+ * 1. Son elemanla yer değiştir ve sondan sil
+ * 2. Yerine gelen elemanı yukarı veya aşağı kaydır
+ * 3. Görevi döndür (havuzda kalır; indeks ve durum çağırana ait)
+ */
+ScheduledTask* TaskRegistry::eraseAt(size_t pos) {
+    ScheduledTask* task = heapTasks_[pos];
+    size_t last = heap_.size() - 1;
+
+    if (pos != last) {
+        swapEntries(pos, last);
+    }
+    heap_.pop_back();
+    heapTasks_.pop_back();
+
+    if (pos < heap_.size()) {
+        siftDown(pos);
+        siftUp(pos);
+    }
+    return task;
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * pushReady() / insert() / promoteDue() - Heap'e ve Tekerleğe Yerleştirme
+ * ----------------------------------------------------------------------------
+ * insert(): Aktivasyon anı gelmişse hazır heap'e, gelmemişse tekerleğe (O(1))
+ * promoteDue(): Tekerleği şimdiki ana ilerletir, zamanı gelenleri hazır
+ *               heap'e taşır (görev ve id değişmez, kopya yok). Ufkun
+ *               ötesine kırpılmış görev gerçek anı gelmediyse geri konur.
+ */
+void TaskRegistry::pushReady(ScheduledTask* task) {
+    HeapEntry entry{packKey(task->realtime, task->priority, toNs(task->absoluteDeadline())),
+                    nextSeq_++};
+    task->state_ = ScheduledTask::State::Ready;
+    task->heapPos_ = heap_.size();
+    heap_.push_back(entry);
+    heapTasks_.push_back(task);
+    siftUp(heap_.size() - 1);
+}
+
+void TaskRegistry::insert(ScheduledTask* task, int64_t now) {
+    int64_t release = toNs(task->release_time);
+    // Tekerlek başka bir thread'in daha geç okuduğu saatle ilerlemiş olabilir:
+    // onun zamanına göre gelmiş görev doğrudan hazırdır
+    if (release > now && wheel_.insert(linkOf(task), toTick(release))) {
+        task->state_ = ScheduledTask::State::Waiting;
+    } else {
+        pushReady(task);
+    }
+}
+
+size_t TaskRegistry::promoteDue(int64_t now) {
+    return wheel_.advance(now / 1000, [this, now](TimerLink* link) {
+        ScheduledTask* task = taskOf(link);
+        if (toNs(task->release_time) > now) {
+            insert(task, now);  // Ufka kırpılmıştı, henüz erken
+        } else {
+            pushReady(task);
+        }
+    });
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * takeNext() / release() - Ödünç Verme Yardımcıları
+ * ----------------------------------------------------------------------------
+ * takeNext(): Kökü çıkarır. Görev complete() ile geri verilene kadar
+ *             indekste kalır: contains() "bitmedi" der (Scheduler::wait
+ *             buna dayanır), periyodik görev çalışırken iptal edilebilir.
+ * release():  Görevi yok edip havuza döndürür (yakalanan kaynaklar hemen
+ *             bırakılır). Bütçeli periyodik görevde releaseHook_ çağrılır.
+ */
+ScheduledTask* TaskRegistry::takeNext() {
+    promoteDue(toNs(Clock::now()));
+    if (heap_.empty()) return nullptr;
+
+    ScheduledTask* task = eraseAt(0);
+    task->state_ = ScheduledTask::State::Running;
+    return task;
+}
+
+void TaskRegistry::release(ScheduledTask* task) {
+    if (releaseHook_ && task->wcet.count() > 0 && task->isPeriodic()) releaseHook_(task->id);
+    pool_.destroy(task);
+}
+
 /**
  * ----------------------------------------------------------------------------
  * registerTask() - Yeni Görev Kaydet
@@ -27,32 +302,86 @@ namespace jts {
  * MANTIK:
  * 1. Mutex kilitle (diğer thread'ler beklesin)
  * 2. Görevin ID'sini otomatik artan sayaçtan al
- * 3. Görevi listeye ekle
+ * 3. Görevi havuzda ScheduledTask olarak oluştur (ad tabloya, çekirdek
+ *    listesi maskeye, iş fonksiyonu satır içi depoya), anahtarını hazır ya
+ *    da zamanlama tekerleğine ekle (O(log n) / O(1))
  * 4. Atanan ID'yi döndür
  * 
- * @param task Kaydedilecek görev (kopyalanarak alınır)
+ * @param task Kaydedilecek görev (taşınarak alınır)
+ * @param work İş fonksiyonu (boşsa task.work kullanılır)
  * @return Atanan benzersiz ID
  */
 uint64_t TaskRegistry::registerTask(Task task) {
+    return registerTask(std::move(task), nullptr);
+}
+
+uint64_t TaskRegistry::registerTask(Task task, TaskFunction work) {
+    // Maskeye sığmayan çekirdek sessizce düşerse görev sabitlenmeden çalışırdı
+    if (!CpuMask::representable(task.cpu_cores)) return 0;
+
     // lock_guard: Constructor'da kilitle, destructor'da otomatik aç
     // Bu sayede fonksiyon herhangi bir noktada çıksa bile kilit açılır
     std::lock_guard<std::mutex> lock(mutex_);
     
     task.id = nextId_++;        // ID ata ve sayacı artır
-    tasks_.push_back(task);     // Görevi listenin sonuna ekle
-    return task.id;             // Atanan ID'yi döndür
+    ScheduledTask* node = pool_.create(std::move(task), std::move(work));
+    index_.insert(node->id, node);
+    JTS_TRACE(TraceEvent::Enqueue, node->id, node->name);
+    insert(node, toNs(Clock::now()));
+    return node->id;            // Atanan ID'yi döndür
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * registerTasks() - Toplu Kayıt
+ * ----------------------------------------------------------------------------
+ * registerTask() ile aynı, ama tüm liste tek kilit altında eklenir ve
+ * havuz/heap/indeks kapasitesi bir kez büyütülür. Binlerce küçük görevde
+ * görev başına kilit ve "now" okuması ortadan kalkar.
+ *
+ * @param tasks Kaydedilecek görevler (taşınarak alınır)
+ * @return Atanan ID'ler (tasks ile aynı sırada, ardışık)
+ */
+std::vector<uint64_t> TaskRegistry::registerTasks(std::vector<Task> tasks) {
+    std::vector<uint64_t> ids;
+    ids.reserve(tasks.size());
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t total = index_.size() + tasks.size();
+    pool_.reserve(pool_.live() + tasks.size());
+    heap_.reserve(heap_.size() + tasks.size());
+    heapTasks_.reserve(heap_.size() + tasks.size());
+    index_.reserve(total);
+
+    int64_t now = toNs(Clock::now());
+    for (auto& task : tasks) {
+        if (!CpuMask::representable(task.cpu_cores)) {
+            ids.push_back(0);
+            continue;
+        }
+        task.id = nextId_++;
+        ScheduledTask* node = pool_.create(std::move(task), nullptr);
+        index_.insert(node->id, node);
+        JTS_TRACE(TraceEvent::Enqueue, node->id, node->name);
+        insert(node, now);
+        ids.push_back(node->id);
+    }
+    return ids;
 }
 
 /**
  * ----------------------------------------------------------------------------
  * getTask() - ID ile Görev Getir
  * ----------------------------------------------------------------------------
- * Verilen ID'ye sahip görevi arar ve bulursa döndürür.
+ * Verilen ID'ye sahip görevi hash indeksinden bulur (O(1)).
  * 
  * std::optional KULLANIMI:
  * - Görev bulunursa: optional içinde Task döner
  * - Görev bulunamazsa: std::nullopt (boş değer) döner
  * - Bu yaklaşım nullptr ile uğraşmaktan daha güvenlidir
+ *
+ * İş fonksiyonu kopyalanmaz (TaskFunction taşınabilir ama kopyalanamaz);
+ * dönen kopyanın work alanı boştur.
  * 
  * @param id Aranan görevin ID'si
  * @return Bulunan görev veya boş (nullopt)
@@ -62,11 +391,9 @@ uint64_t TaskRegistry::registerTask(Task task) {
 std::optional<Task> TaskRegistry::getTask(uint64_t id) const {
     std::lock_guard<std::mutex> lock(mutex_);
     
-    // Tüm görevleri dolaş ve ID'yi ara
-    for (const auto& t : tasks_) {
-        if (t.id == id) return t;  // Bulundu, görevi döndür
-    }
-    return std::nullopt;  // Bulunamadı, boş değer döndür
+    ScheduledTask* task = index_.find(id);
+    if (!task) return std::nullopt;  // Bulunamadı
+    return task->toTask();           // Bulundu, kopyasını döndür
 }
 
 /**
@@ -78,49 +405,187 @@ std::optional<Task> TaskRegistry::getTask(uint64_t id) const {
  * NEDEN KOPYA?
  * - Orijinal listeye doğrudan erişim thread-safe olmaz
  * - Çağıran kod listeyi istediği gibi kullanabilir
+ *
+ * Heap sırası kullanıcı için anlamlı olmadığından liste ID'ye (yani kayıt
+ * sırasına) göre sıralanır. Bu fonksiyon zamanlama yolunda kullanılmaz.
  * 
  * @return Tüm görevlerin kopyası
  */
 std::vector<Task> TaskRegistry::listTasks() const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return tasks_;  // Listenin kopyasını döndür
+
+    std::vector<Task> tasks;
+    tasks.reserve(index_.size());
+    index_.forEach([&tasks](const ScheduledTask* task) {
+        tasks.push_back(task->toTask());
+    });
+    std::sort(tasks.begin(), tasks.end(),
+        [](const Task& a, const Task& b) { return a.id < b.id; });
+    return tasks;
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * popHighest() - En Yüksek Öncelikli Görevi Al ve Sil
+ * ----------------------------------------------------------------------------
+ * Heap'in kökündeki görevi çıkarır ve Task olarak döndürür.
+ *
+ * NEDEN ATOMİK?
+ * Eskiden seçim (listTasks + max_element) ve silme (removeTask) ayrı
+ * kilitlerle yapılıyordu; arada başka bir thread aynı görevi alabilirdi.
+ * Burada ikisi de tek kilit altında, O(log n) sürede yapılır.
+ *
+ * Görev registry'den tamamen çıkar. İş fonksiyonu paylaşılan bir kutuya
+ * taşınıp std::function ile sarılır; bu yol allocation yapar, zamanlayıcı
+ * acquireNext() / complete() kullanır.
+ *
+ * @return Çıkarılan görev veya boş (nullopt)
+ */
+std::optional<Task> TaskRegistry::popHighest() {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ScheduledTask* node = takeNext();
+    if (!node) return std::nullopt;
+
+    index_.erase(node->id);
+    Task task = node->toTask();
+    if (node->work) {
+        auto fn = std::make_shared<TaskFunction>(std::move(node->work));
+        task.work = [fn]() { (*fn)(); };
+    }
+    release(node);
+    return task;
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * acquireNext() - Sıradaki Görevi Ödünç Al
+ * ----------------------------------------------------------------------------
+ * Zamanlayıcının sıcak yolu: görev kopyalanmaz veya taşınmaz, sadece
+ * işaretçisi verilir. Kilit altında yapılan iş heap'ten silmekten ibarettir.
+ */
+ScheduledTask* TaskRegistry::acquireNext() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return takeNext();
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * complete() - Ödünç Alınan Görevi Geri Ver
+ * ----------------------------------------------------------------------------
+ * Aktivasyon ölçümleri burada, kilit altında işlenir (getTask() ile
+ * eşzamanlı okuma yarışmaz). Periyodik görev aynı havuz nesnesiyle bir
+ * sonraki aktivasyon anında zamanlama tekerleğine geri konur; ad, maske ve
+ * iş fonksiyonu yerinde kalır (kopya/allocation yok).
+ *
+ * Diğer durumlarda görev indeksten silinir (iptal edildiyse zaten
+ * silinmişti) ve havuza döner.
+ *
+ * @return true: geri kondu, false: tek seferlik ya da çalışırken
+ *         removeTask() ile iptal edildi (havuza döndü)
+ */
+bool TaskRegistry::complete(ScheduledTask* task, const ActivationResult& result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    task->activations++;
+    if (result.missed) task->deadline_misses++;
+    if (result.overrun) task->budget_overruns++;
+    if (result.runtime > task->max_runtime) task->max_runtime = result.runtime;
+
+    if (task->state_ == ScheduledTask::State::Running) {
+        if (task->isPeriodic()) {
+            // Kaymasız: önceki aktivasyon + periyot (gecikme olduysa hemen hazır)
+            task->release_time += task->period;
+            insert(task, toNs(Clock::now()));
+            return true;
+        }
+        index_.erase(task->id);
+    }
+    release(task);
+    return false;
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * nextRelease() - En Yakın Aktivasyon Anı
+ * ----------------------------------------------------------------------------
+ * Scheduler, hazır görev yokken bu ana kadar uyur. Tekerlekten O(kLevels)
+ * ile okunur; üst seviyedeki yuva için yuva başlangıcıdır (erken uyanılır,
+ * promoteDue() görevleri alt seviyelere indirir).
+ */
+std::optional<TaskRegistry::Clock::time_point> TaskRegistry::nextRelease() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    std::optional<int64_t> tick = wheel_.nextExpiry();
+    if (!tick) return std::nullopt;
+    return Clock::time_point(std::chrono::microseconds(*tick));
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * releaseDue() - Zamanı Gelenleri Hazır Heap'e Taşı
+ * ----------------------------------------------------------------------------
+ */
+size_t TaskRegistry::releaseDue() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return promoteDue(toNs(Clock::now()));
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * readyCount() - Hazır Görev Sayısı
+ * ----------------------------------------------------------------------------
+ * Zamanı gelmiş ama henüz taşınmamış görevler sayılmaz; onlar bir sonraki
+ * acquireNext() çağrısında hazır heap'e geçer.
+ */
+size_t TaskRegistry::readyCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return heap_.size();
 }
 
 /**
  * ----------------------------------------------------------------------------
  * removeTask() - Görevi Sil
  * ----------------------------------------------------------------------------
- * Verilen ID'ye sahip görevi listeden kaldırır.
- * 
- * REMOVE-ERASE İDİOMU:
- * C++'ta vector'dan eleman silmek için iki aşamalı işlem gerekir:
- * 1. std::remove_if: Silinecek elemanları sona taşı
- * 2. erase: Taşınan elemanları gerçekten sil
+ * Verilen ID'ye sahip görevi kayıt defterinden kaldırır.
  * 
- * Bu idiom performans açısından tek tek silmekten daha verimlidir.
+ * MANTIK:
+ * 1. index_ ile görevi bul (O(1))
+ * 2. Hazır heap'teyse elemanı sil ve heap'i düzelt (O(log n)),
+ *    tekerlekteyse yuvasının listesinden çıkar (O(1)); görevi havuza döndür
+ * 3. Görev o an çalışan periyodik bir görevse iptal olarak işaretle;
+ *    complete() onu geri koymaz. Çalışan tek seferlik görev zaten bir daha
+ *    çalışmayacağı için dokunulmaz.
  * 
  * @param id Silinecek görevin ID'si
- * @return true: Silindi, false: ID bulunamadı
+ * @return true: Silindi, false: ID bulunamadı veya tek seferlik görev
+ *         zaten çalışıyor
  */
 bool TaskRegistry::removeTask(uint64_t id) {
     std::lock_guard<std::mutex> lock(mutex_);
 
-    // remove_if: Koşulu sağlayan elemanları sona taşır
-    // Lambda fonksiyonu: [id] dış kapsamdan id değişkenini yakalar
-    auto it = std::remove_if(
-        tasks_.begin(),     // Arama başlangıcı
-        tasks_.end(),       // Arama sonu
-        [id](const Task& t) {  // Her eleman için çalışacak koşul fonksiyonu
-            return t.id == id;  // Bu görev silinecek mi?
-        }
-    );
+    ScheduledTask* task = index_.find(id);
+    if (!task) return false;
+    if (task->state_ == ScheduledTask::State::Running && !task->isPeriodic()) {
+        return false;
+    }
+    index_.erase(id);
 
-    // Eğer silinecek eleman bulunduysa
-    if (it != tasks_.end()) {
-        tasks_.erase(it, tasks_.end());  // Sona taşınan elemanları sil
-        return true;  // Başarılı
+    switch (task->state_) {
+        case ScheduledTask::State::Ready:
+            eraseAt(task->heapPos_);
+            release(task);
+            break;
+        case ScheduledTask::State::Waiting:
+            wheel_.remove(linkOf(task));
+            release(task);
+            break;
+        default:
+            // Çalışıyor: sahibi complete() çağırınca serbest kalır
+            task->state_ = ScheduledTask::State::Cancelled;
+            break;
     }
-    return false;  // ID bulunamadı
+    return true;  // Başarılı
 }
 
 
@@ -130,22 +595,76 @@ bool TaskRegistry::removeTask(uint64_t id) {
  * ----------------------------------------------------------------------------
  * Kayıtlı görev adedini döndürür.
  * 
- * @return Listedeki görev sayısı
+ * @return Hazır ve aktivasyon bekleyen görevlerin toplamı
  */
 size_t TaskRegistry::count() const {
     std::lock_guard<std::mutex> lock(mutex_);
-    return tasks_.size();  // Vector'ün eleman sayısı
+    return heap_.size() + wheel_.size();
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * contains() / activeCount() - Bitmemiş Görevler
+ * ----------------------------------------------------------------------------
+ * count()'tan farkı: ödünç alınmış (çalışan veya worker kuyruğunda
+ * bekleyen) görevler de sayılır. Görev complete() ile bitene ya da iptal
+ * edilene kadar "aktif"tir.
+ */
+bool TaskRegistry::contains(uint64_t id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.find(id) != nullptr;
+}
+
+size_t TaskRegistry::activeCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.size();
 }
 
 /**
  * ----------------------------------------------------------------------------
  * clear() - Tüm Görevleri Temizle
  * ----------------------------------------------------------------------------
- * Listeyi tamamen boşaltır. Dikkatli kullanılmalı!
+ * Kayıt defterini tamamen boşaltır. Dikkatli kullanılmalı!
  */
 void TaskRegistry::clear() {
     std::lock_guard<std::mutex> lock(mutex_);
-    tasks_.clear();  // Tüm elemanları sil
+    index_.forEach([](ScheduledTask* task) {
+        if (task->state_ == ScheduledTask::State::Running) {
+            task->state_ = ScheduledTask::State::Cancelled;
+        }
+    });
+    for (ScheduledTask* task : heapTasks_) release(task);
+    wheel_.forEach([this](TimerLink* link) { release(taskOf(link)); });
+    heap_.clear();
+    heapTasks_.clear();
+    wheel_.clear();
+    index_.clear();
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * reserve() - Kapasite Ayır
+ * ----------------------------------------------------------------------------
+ * Havuz, hazır heap ve indeks count görevi allocation yapmadan alacak kadar
+ * büyütülür. Gerçek zamanlı sistemlerde başlangıçta bir kez çağrılır.
+ */
+void TaskRegistry::reserve(size_t count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pool_.reserve(count);
+    heap_.reserve(count);
+    heapTasks_.reserve(count);
+    index_.reserve(count);
+}
+
+/**
+ * ----------------------------------------------------------------------------
+ * setReleaseHook() - Bütçeli Görev Çıkış Bildirimi
+ * ----------------------------------------------------------------------------
+ * Tüm çıkış yolları release()'ten geçer; bildirim orada yapılır.
+ */
+void TaskRegistry::setReleaseHook(ReleaseHook hook) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    releaseHook_ = std::move(hook);
 }
 
 } // namespace jts
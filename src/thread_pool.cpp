@@ -1,70 +1,321 @@
 #include "thread_pool.hpp"
 #include "cpu_utils.hpp"
-#include <iostream>
+#include "logger.hpp"
+#include "topology.hpp"
+#include "trace.hpp"
+#include <algorithm>
+#include <exception>
+#include <thread>
 
 namespace jts {
 
-ThreadPool::ThreadPool(size_t numThreads) {
-    if (numThreads == 0) {
-        numThreads = static_cast<size_t>(getCpuCount());
+namespace {
+
+// Bu thread'de çalışmakta olan havuz işinin şeridi (havuz dışında varsayılan)
+thread_local size_t currentLane = ThreadPool::kDefaultPriority;
+
+PoolOptions fixedSize(size_t numThreads, std::chrono::microseconds agingStep) {
+    PoolOptions options;
+    options.minThreads = numThreads;
+    options.agingStep = agingStep;
+    return options;
+}
+
+// Spin döngüsünde çekirdeğe "bekliyorum" ipucu (SMT kardeşine yer açar)
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+} // namespace
+
+ThreadPool::ThreadPool(size_t numThreads, std::chrono::microseconds agingStep)
+    : ThreadPool(fixedSize(numThreads, agingStep)) {}
+
+ThreadPool::ThreadPool(const PoolOptions& options)
+    : agingStep_(std::max(options.agingStep, std::chrono::microseconds(0))),
+      spin_(std::max(options.spin, std::chrono::microseconds(0))),
+      idleTimeout_(std::max(options.idleTimeout, std::chrono::milliseconds(1))) {
+    min_ = options.minThreads == 0 ? static_cast<size_t>(getCpuCount()) : options.minThreads;
+    max_ = std::max(min_, options.maxThreads);
+
+    if (max_ > min_) {
+        JTS_LOG_INFO("[ThreadPool] %zu worker başlatılıyor (en fazla %zu)", min_, max_);
+    } else {
+        JTS_LOG_INFO("[ThreadPool] %zu worker başlatılıyor", min_);
     }
 
-    std::cout << "[ThreadPool] " << numThreads << " worker başlatılıyor\n";
+    // Worker'lar tek çekirdeğe değil, placement() çekirdeğinin cache grubuna
+    // sabitlenir: aynı gruptakiler L2/L3'ü paylaşır, çekirdek içinde serbest kalır
+    const Topology& topo = Topology::system();
+    std::vector<int> cores = topo.placement(max_);
+    slotCpus_.resize(max_);
+    for (size_t i = 0; i < cores.size(); ++i) {
+        std::vector<int> group = topo.groupOf(cores[i]);
+        if (group.size() < topo.size()) slotCpus_[i] = std::move(group);
+    }
 
-    for (size_t i = 0; i < numThreads; ++i) {
-        workers_.emplace_back([this]() { workerLoop(); });
+    std::lock_guard<std::mutex> growLock(growMutex_);
+    workers_.reserve(max_);  // Yuvalar hiç yer değiştirmez
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        live_ = min_;
+        starting_ = min_;
     }
+    for (size_t i = 0; i < min_; ++i) startWorker(i);
 }
 
 ThreadPool::~ThreadPool() {
     shutdown();
 }
 
-void ThreadPool::submit(std::function<void()> job) {
+size_t ThreadPool::laneOf(int priority, bool realtime) {
+    if (realtime) return kLanes - 1;
+    return static_cast<size_t>(std::min(std::max(priority, 0), kMaxPriority));
+}
+
+size_t ThreadPool::callerLane() {
+    return currentLane;
+}
+
+void ThreadPool::enqueue(size_t lane, std::function<void()> job) {
+    auto now = agingStep_.count() > 0 ? std::chrono::steady_clock::now()
+                                      : std::chrono::steady_clock::time_point();
+    bool wake, addWorker;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        lanes_[lane].push({std::move(job), now});
+        queued_++;
+        wake = parked_ > 0 && queued_ > spinning_ + starting_;
+        addWorker = wantsWorker();
+    }
+    JTS_TRACE_ARG(TraceEvent::Enqueue, 0, "pool_job", static_cast<int>(lane));
+    if (wake) condition_.notify_one();
+    if (addWorker) grow();
+}
+
+void ThreadPool::submitBulk(std::vector<std::function<void()>> jobs, int priority, bool realtime) {
+    enqueueBulk(laneOf(priority, realtime), std::move(jobs));
+}
+
+void ThreadPool::enqueueBulk(size_t lane, std::vector<std::function<void()>> jobs) {
+    if (jobs.empty()) return;
+    auto now = agingStep_.count() > 0 ? std::chrono::steady_clock::now()
+                                      : std::chrono::steady_clock::time_point();
+    bool wake, addWorker;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& job : jobs) {
+            lanes_[lane].push({std::move(job), now});
+        }
+        queued_ += jobs.size();
+        wake = parked_ > 0 && queued_ > spinning_ + starting_;
+        addWorker = wantsWorker();
+    }
+    JTS_TRACE_ARG(TraceEvent::Enqueue, 0, "pool_bulk", static_cast<int>(jobs.size()));
+    if (wake) {
+        if (jobs.size() == 1) {
+            condition_.notify_one();
+        } else {
+            condition_.notify_all();
+        }
+    }
+    if (addWorker) grow();  // Bir worker; kuyruk hâlâ birikmişse sonraki ekleme bir daha
+}
+
+bool ThreadPool::wantsWorker() const {
+    return live_ < max_ && queued_ > spinning_ + parked_ + starting_;
+}
+
+void ThreadPool::grow() {
+    // Başka bir ekleyen zaten büyütüyorsa (veya shutdown sürüyorsa) atla:
+    // büyüme sadece hızlandırır, işler mevcut worker'larla da biter
+    std::unique_lock<std::mutex> growLock(growMutex_, std::try_to_lock);
+    if (!growLock) return;
+
+    size_t slot;
     {
         std::lock_guard<std::mutex> lock(mutex_);
-        jobs_.push(std::move(job));
+        if (stop_ || !wantsWorker()) return;
+        live_++;
+        starting_++;
+        if (!exited_.empty()) {
+            slot = exited_.back();
+            exited_.pop_back();
+        } else {
+            slot = workers_.size();
+        }
+    }
+    // Yuvanın eski sahibi çıktı (veya çıkmak üzere): beklemesi kısa
+    if (slot < workers_.size() && workers_[slot].joinable()) workers_[slot].join();
+    JTS_LOG_DEBUG("[ThreadPool] Worker eklendi (%zu açık)", live_.load());
+    startWorker(slot);
+}
+
+void ThreadPool::startWorker(size_t slot) {
+    std::thread worker([this, slot]() { workerLoop(slot); });
+    if (!slotCpus_[slot].empty()) setThreadAffinity(worker, slotCpus_[slot]);
+    if (slot == workers_.size()) {
+        workers_.push_back(std::move(worker));
+    } else {
+        workers_[slot] = std::move(worker);
+    }
+}
+
+void ThreadPool::spinWait() const {
+    // İlk yarı pause (en düşük uyanma gecikmesi), ikinci yarı yield (aynı
+    // çekirdekteki başka thread'lere yer açar); saat 32 turda bir okunur
+    const auto start = std::chrono::steady_clock::now();
+    bool yielding = false;
+    for (unsigned i = 1;; ++i) {
+        if (queued_.load(std::memory_order_relaxed) > 0 ||
+            stop_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if ((i & 31) == 0) {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            if (elapsed >= spin_) return;
+            yielding = elapsed >= spin_ / 2;
+        }
+        if (yielding) {
+            std::this_thread::yield();
+        } else {
+            cpuRelax();
+        }
+    }
+}
+
+size_t ThreadPool::pickLane() const {
+    constexpr size_t rt = kLanes - 1;
+    if (!lanes_[rt].empty()) return rt;
+
+    size_t top = kMaxPriority;
+    while (lanes_[top].empty()) --top;  // queued_ > 0: en az bir şerit dolu
+    if (agingStep_.count() == 0 || top == 0) return top;
+
+    // Her şeridin başı o şeridin en eskisidir: etkin seviye = şerit + bekleme
+    // / agingStep (en fazla kMaxPriority). En yüksek seviye, eşitse en eski.
+    auto now = std::chrono::steady_clock::now();
+    size_t best = top;
+    int bestLevel = static_cast<int>(top);
+    auto bestTime = lanes_[top].front().enqueued;
+    for (size_t lane = top; lane-- > 0;) {
+        if (lanes_[lane].empty()) continue;
+        auto enqueued = lanes_[lane].front().enqueued;
+        auto steps = (now - enqueued) / agingStep_;
+        int level = static_cast<int>(std::min<decltype(steps)>(
+            static_cast<decltype(steps)>(lane) + steps, kMaxPriority));
+        if (level > bestLevel || (level == bestLevel && enqueued < bestTime)) {
+            best = lane;
+            bestLevel = level;
+            bestTime = enqueued;
+        }
     }
-    condition_.notify_one();
+    return best;
+}
+
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idleCv_.wait(lock, [this]() { return queued_ == 0 && active_ == 0; });
 }
 
 size_t ThreadPool::pending() const {
-    std::lock_guard<std::mutex> lock(const_cast<std::mutex&>(mutex_));
-    return jobs_.size();
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queued_;
+}
+
+size_t ThreadPool::pending(int priority, bool realtime) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lanes_[laneOf(priority, realtime)].size();
 }
 
 void ThreadPool::shutdown() {
-    stop_ = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
     condition_.notify_all();
-    
+
+    std::lock_guard<std::mutex> growLock(growMutex_);
     for (auto& worker : workers_) {
         if (worker.joinable()) {
             worker.join();
         }
     }
     workers_.clear();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    exited_.clear();
+    live_ = 0;
 }
 
-void ThreadPool::workerLoop() {
-    while (!stop_) {
-        std::function<void()> job;
-        
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            condition_.wait(lock, [this]() {
-                return stop_ || !jobs_.empty();
-            });
-            
-            if (stop_ && jobs_.empty()) return;
-            
-            job = std::move(jobs_.front());
-            jobs_.pop();
+void ThreadPool::workerLoop(size_t slot) {
+    // stop_ sonrası da kuyruk boşalana kadar devam: verilen her Future tamamlanır
+    std::unique_lock<std::mutex> lock(mutex_);
+    starting_--;
+    auto ready = [this]() { return stop_ || queued_ > 0; };
+
+    while (true) {
+        if (!ready()) {
+            // Önce spin (ekleyen bizi görürse futex uyandırması yapmaz)
+            if (spin_.count() > 0) {
+                spinning_++;
+                lock.unlock();
+                spinWait();
+                lock.lock();
+                spinning_--;
+                if (ready()) continue;
+            }
+
+            // Sonra park; minThreads üstündeysek idleTimeout sonunda çık
+            parked_++;
+            bool woke = true;
+            if (live_ > min_) {
+                woke = condition_.wait_for(lock, idleTimeout_, ready);
+            } else {
+                condition_.wait(lock, ready);
+            }
+            parked_--;
+            if (!woke && live_ > min_) {
+                live_--;
+                exited_.push_back(slot);  // Thread'i bir sonraki grow() join eder
+                return;
+            }
+            continue;
         }
-        
-        // İşi çalıştır
+        if (queued_ == 0) return;  // stop_ ve kuyruk boş
+
+        size_t lane = pickLane();
+        std::function<void()> job = std::move(lanes_[lane].front().fn);
+        lanes_[lane].pop();
+        queued_--;
+        active_++;
+        lock.unlock();
+
+        // İşi çalıştır (içinden parallelFor çağrılırsa yardımcılar bu şeride girer)
         if (job) {
-            job();
+            currentLane = lane;
+            JTS_TRACE(TraceEvent::Start, 0, "pool_job");
+            // submit()/parallelFor istisnayı kendisi yakalar; Future'sız
+            // submitBulk işleri burada yakalanıp loglanır (worker ölmez)
+            try {
+                job();
+            } catch (const std::exception& e) {
+                JTS_LOG_ERROR("[ThreadPool] Toplu iş istisna fırlattı: %s", e.what());
+            } catch (...) {
+                JTS_LOG_ERROR("[ThreadPool] Toplu iş bilinmeyen istisna fırlattı");
+            }
+            JTS_TRACE(TraceEvent::End, 0, "pool_job");
+            currentLane = kDefaultPriority;
         }
+        job = nullptr;  // Yakalananlar bariyerden önce yok edilsin
+
+        lock.lock();
+        active_--;
+        if (active_ == 0 && queued_ == 0) idleCv_.notify_all();
     }
 }
 
@@ -0,0 +1,102 @@
+#include "timing_wheel.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace jts {
+
+namespace {
+
+constexpr uint64_t kSlotMask = TimingWheel::kSlots - 1;
+
+// Şimdiki an ile when'in ilk farklı olduğu 6 bitlik grup = seviye
+int levelFor(int64_t elapsed, int64_t when) {
+    uint64_t masked = (static_cast<uint64_t>(elapsed) ^ static_cast<uint64_t>(when)) | kSlotMask;
+    masked = std::min<uint64_t>(masked, static_cast<uint64_t>(TimingWheel::kHorizon));
+    int significant = 63 - __builtin_clzll(masked);
+    return significant / TimingWheel::kSlotBits;
+}
+
+int slotFor(int64_t when, int level) {
+    return static_cast<int>((static_cast<uint64_t>(when) >> (level * TimingWheel::kSlotBits)) &
+                            kSlotMask);
+}
+
+uint64_t rotateRight(uint64_t x, int n) {
+    return n == 0 ? x : (x >> n) | (x << (64 - n));
+}
+
+} // namespace
+
+bool TimingWheel::insert(TimerLink* item, int64_t when) {
+    if (when <= elapsed_) return false;
+    item->when = std::min(when, elapsed_ + kHorizon);
+    link(item);
+    return true;
+}
+
+void TimingWheel::link(TimerLink* item) {
+    int level = levelFor(elapsed_, item->when);
+    int slot = slotFor(item->when, level);
+    TimerLink*& head = slots_[level][slot];
+    item->prev = nullptr;
+    item->next = head;
+    if (head) head->prev = item;
+    head = item;
+    item->bucket = static_cast<uint16_t>(level * kSlots + slot);
+    occupied_[level] |= uint64_t(1) << slot;
+    size_++;
+}
+
+void TimingWheel::remove(TimerLink* item) {
+    int level = item->bucket / kSlots;
+    int slot = item->bucket % kSlots;
+    if (item->prev) {
+        item->prev->next = item->next;
+    } else {
+        slots_[level][slot] = item->next;
+    }
+    if (item->next) item->next->prev = item->prev;
+    if (!slots_[level][slot]) occupied_[level] &= ~(uint64_t(1) << slot);
+    item->prev = item->next = nullptr;
+    size_--;
+}
+
+TimerLink* TimingWheel::take(int level, int slot) {
+    TimerLink* list = slots_[level][slot];
+    slots_[level][slot] = nullptr;
+    occupied_[level] &= ~(uint64_t(1) << slot);
+    return list;
+}
+
+std::optional<TimingWheel::Expiry> TimingWheel::next() const {
+    // Alt seviyedeki her öğe üst seviyedekilerden erkendir: ilk dolu seviye yeter
+    for (int level = 0; level < kLevels; ++level) {
+        if (occupied_[level] == 0) continue;
+        int nowSlot = slotFor(elapsed_, level);
+        int slot = (__builtin_ctzll(rotateRight(occupied_[level], nowSlot)) + nowSlot) &
+                   static_cast<int>(kSlotMask);
+
+        const int64_t slotRange = int64_t(1) << (level * kSlotBits);
+        const int64_t levelRange = slotRange << kSlotBits;
+        int64_t deadline = (elapsed_ & ~(levelRange - 1)) + slot * slotRange;
+        // Sadece en üst seviyede: ufka kırpılmış öğe şimdiki yuvanın "gerisinde"
+        // kalabilir, bir sonraki turdadır
+        if (level == kLevels - 1 && slot <= nowSlot) deadline += levelRange;
+        return Expiry{level, slot, deadline};
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> TimingWheel::nextExpiry() const {
+    std::optional<Expiry> e = next();
+    if (!e) return std::nullopt;
+    return e->deadline;
+}
+
+void TimingWheel::clear() {
+    for (auto& level : slots_) std::fill(std::begin(level), std::end(level), nullptr);
+    std::fill(std::begin(occupied_), std::end(occupied_), 0);
+    size_ = 0;
+}
+
+} // namespace jts
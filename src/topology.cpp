@@ -0,0 +1,235 @@
+#include "topology.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+
+// Linux headers
+#include <dirent.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace jts {
+
+namespace {
+
+bool readFile(const std::string& path, std::string& out) {
+    std::ifstream in(path);
+    if (!in) return false;
+    std::getline(in, out);
+    while (!out.empty() && (out.back() == '\n' || out.back() == ' ' || out.back() == '\r')) {
+        out.pop_back();
+    }
+    return true;
+}
+
+int readInt(const std::string& path, int fallback) {
+    std::string text;
+    int value;
+    if (!readFile(path, text) || std::sscanf(text.c_str(), "%d", &value) != 1) return fallback;
+    return value;
+}
+
+} // namespace
+
+std::vector<int> parseCpuList(const std::string& text) {
+    std::vector<int> out;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t comma = text.find(',', pos);
+        if (comma == std::string::npos) comma = text.size();
+        std::string part = text.substr(pos, comma - pos);
+        int a, b;
+        int n = std::sscanf(part.c_str(), "%d-%d", &a, &b);
+        if (n == 2 && a >= 0 && b >= a && b - a < 4096) {
+            for (int i = a; i <= b; ++i) out.push_back(i);
+        } else if (n >= 1 && a >= 0) {
+            out.push_back(a);
+        }
+        pos = comma + 1;
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+Topology Topology::discover(const std::string& sysRoot) {
+    Topology topo;
+    const std::string cpuDir = sysRoot + "/devices/system/cpu";
+    std::string text;
+
+    std::vector<int> online;
+    if (readFile(cpuDir + "/online", text)) online = parseCpuList(text);
+    if (online.empty()) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        for (long i = 0; i < std::max(1L, n); ++i) online.push_back(static_cast<int>(i));
+    }
+
+    std::vector<int> isolated;
+    if (readFile(cpuDir + "/isolated", text)) isolated = parseCpuList(text);
+
+    for (int id : online) {
+        CpuInfo c;
+        c.id = id;
+        const std::string base = cpuDir + "/cpu" + std::to_string(id);
+        c.package = std::max(0, readInt(base + "/topology/physical_package_id", 0));
+        c.cluster = readInt(base + "/topology/cluster_id", c.package);
+        if (c.cluster < 0) c.cluster = c.package;
+        c.core = readInt(base + "/topology/core_id", id);
+
+        // index0..N: seviye + paylaşan CPU listesi (komut cache'i atlanır)
+        for (int idx = 0;; ++idx) {
+            const std::string cache = base + "/cache/index" + std::to_string(idx);
+            int level = readInt(cache + "/level", -1);
+            if (level < 0) break;
+            std::string type;
+            if (readFile(cache + "/type", type) && type == "Instruction") continue;
+            if (!readFile(cache + "/shared_cpu_list", text)) continue;
+            std::vector<int> shared = parseCpuList(text);
+            int key = shared.empty() ? id : shared.front();
+            if (level == 2) c.l2 = key;
+            if (level == 3) c.l3 = key;
+        }
+
+        c.isolated = std::binary_search(isolated.begin(), isolated.end(), id);
+        topo.cpus_.push_back(c);
+    }
+
+    // NUMA düğümleri: nodeK/cpulist (düğüm dizini yoksa hepsi 0)
+    const std::string nodeDir = sysRoot + "/devices/system/node";
+    size_t nodes = 0;
+    if (DIR* dir = opendir(nodeDir.c_str())) {
+        while (dirent* entry = readdir(dir)) {
+            int node;
+            char tail;
+            if (std::sscanf(entry->d_name, "node%d%c", &node, &tail) != 1) continue;
+            if (!readFile(nodeDir + "/" + entry->d_name + "/cpulist", text)) continue;
+            nodes++;
+            for (int id : parseCpuList(text)) {
+                for (auto& c : topo.cpus_) {
+                    if (c.id == id) c.node = node;
+                }
+            }
+        }
+        closedir(dir);
+    }
+    topo.nodeCount_ = std::max<size_t>(1, nodes);
+
+    topo.finalize();
+    return topo;
+}
+
+void Topology::finalize() {
+    // Bir cache'i paylaşan fiziksel çekirdek sayısı (SMT kardeşleri tek sayılır)
+    auto physicalSharers = [this](int CpuInfo::*level, int key) {
+        std::set<std::pair<int, int>> cores;
+        for (const auto& c : cpus_) {
+            if (c.*level == key) cores.insert({c.package, c.core});
+        }
+        return cores.size();
+    };
+
+    // Grup anahtarı: (düğüm, paket, seviye, cache anahtarı)
+    std::vector<std::tuple<int, int, int, int>> keys;
+    for (const auto& c : cpus_) {
+        if (c.l2 >= 0 && physicalSharers(&CpuInfo::l2, c.l2) > 1) {
+            keys.emplace_back(c.node, c.package, 2, c.l2);
+        } else if (c.l3 >= 0) {
+            keys.emplace_back(c.node, c.package, 3, c.l3);
+        } else {
+            keys.emplace_back(c.node, c.package, 0, c.package);
+        }
+    }
+    std::vector<std::tuple<int, int, int, int>> sorted = keys;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    for (size_t i = 0; i < cpus_.size(); ++i) {
+        cpus_[i].cacheGroup = static_cast<int>(
+            std::lower_bound(sorted.begin(), sorted.end(), keys[i]) - sorted.begin());
+    }
+}
+
+const Topology& Topology::system() {
+    // Affinity ilk çağıran thread'den okunur (normalde ana thread, worker'lar
+    // sabitlenmeden önce)
+    static const Topology topo = []() {
+        Topology t = discover("/sys");
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+            for (auto& c : t.cpus_) {
+                c.allowed = c.id < CPU_SETSIZE && CPU_ISSET(c.id, &set);
+            }
+        }
+        return t;
+    }();
+    return topo;
+}
+
+const CpuInfo* Topology::cpu(int id) const {
+    auto it = std::lower_bound(cpus_.begin(), cpus_.end(), id,
+        [](const CpuInfo& c, int value) { return c.id < value; });
+    return it != cpus_.end() && it->id == id ? &*it : nullptr;
+}
+
+bool Topology::isolated(int id) const {
+    const CpuInfo* c = cpu(id);
+    return c && c->isolated;
+}
+
+bool Topology::sameCacheGroup(int a, int b) const {
+    const CpuInfo* ca = cpu(a);
+    const CpuInfo* cb = cpu(b);
+    return ca && cb && ca->cacheGroup == cb->cacheGroup;
+}
+
+std::vector<std::vector<int>> Topology::cacheGroups() const {
+    std::map<int, std::vector<int>> groups;
+    for (const auto& c : cpus_) groups[c.cacheGroup].push_back(c.id);
+    std::vector<std::vector<int>> out;
+    for (auto& g : groups) out.push_back(std::move(g.second));
+    return out;
+}
+
+std::vector<int> Topology::groupOf(int id) const {
+    std::vector<int> out;
+    const CpuInfo* self = cpu(id);
+    if (!self) return out;
+    for (const auto& c : cpus_) {
+        if (c.cacheGroup == self->cacheGroup) out.push_back(c.id);
+    }
+    return out;
+}
+
+std::vector<int> Topology::placement(size_t n) const {
+    // SMT sırası: aynı fiziksel çekirdeğin kaçıncı kardeşi. Grup içinde önce
+    // farklı fiziksel çekirdekler doldurulur.
+    std::map<std::pair<int, int>, int> siblings;
+    std::vector<std::tuple<bool, int, int, int, int, int, int>> order;
+    for (const auto& c : cpus_) {
+        bool usable = c.allowed && !c.isolated;
+        int smt = siblings[{c.package, c.core}]++;
+        order.emplace_back(!usable, c.node, c.package, c.cacheGroup, smt, c.core, c.id);
+    }
+    std::sort(order.begin(), order.end());
+
+    // İzinsiz CPU'lar hiç kullanılmaz (hepsi izinsizse yok sayılır)
+    std::vector<int> ids;
+    for (const auto& o : order) {
+        const CpuInfo* c = cpu(std::get<6>(o));
+        if (c->allowed) ids.push_back(c->id);
+    }
+    if (ids.empty()) {
+        for (const auto& o : order) ids.push_back(std::get<6>(o));
+    }
+
+    std::vector<int> out;
+    out.reserve(n);
+    for (size_t i = 0; i < n && !ids.empty(); ++i) out.push_back(ids[i % ids.size()]);
+    return out;
+}
+
+} // namespace jts
@@ -0,0 +1,158 @@
+#include "trace.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <vector>
+
+// Linux headers
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace jts {
+
+namespace {
+
+uint32_t currentTid() {
+    thread_local uint32_t tid = static_cast<uint32_t>(syscall(SYS_gettid));
+    return tid;
+}
+
+const char* phaseOf(TraceEvent event) {
+    switch (event) {
+        case TraceEvent::Start: return "B";
+        case TraceEvent::End:   return "E";
+        default:                return "i";
+    }
+}
+
+const char* labelOf(TraceEvent event) {
+    switch (event) {
+        case TraceEvent::Enqueue:  return "enqueue";
+        case TraceEvent::Dispatch: return "dispatch";
+        case TraceEvent::Start:    return "start";
+        case TraceEvent::End:      return "end";
+        default:                   return "unknown";
+    }
+}
+
+void writeJsonString(std::ostream& out, const char* s) {
+    out << '"';
+    for (; *s; ++s) {
+        unsigned char c = static_cast<unsigned char>(*s);
+        if (c == '"' || c == '\\') {
+            out << '\\' << *s;
+        } else if (c < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            out << buf;
+        } else {
+            out << *s;
+        }
+    }
+    out << '"';
+}
+
+} // namespace
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+void Tracer::enable(size_t capacity) {
+    if (!entries_ || capacity != capacity_) {
+        entries_.reset(new Entry[capacity]);
+        capacity_ = capacity;
+        next_.store(0, std::memory_order_relaxed);
+    }
+    clear();  // Her oturum boş tampon ve sıfır düşürme sayacıyla başlar
+    enabled_.store(true, std::memory_order_release);
+}
+
+void Tracer::disable() {
+    enabled_.store(false, std::memory_order_release);
+}
+
+void Tracer::record(TraceEvent event, uint64_t taskId, const char* name, int arg) {
+    size_t index = next_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= capacity_) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    Entry& e = entries_[index];
+    e.event = event;
+    e.cpu = static_cast<int16_t>(sched_getcpu());
+    e.arg = arg;
+    e.tid = currentTid();
+    e.ts_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    e.task_id = taskId;
+    std::strncpy(e.name, name ? name : "", sizeof(e.name) - 1);
+    e.name[sizeof(e.name) - 1] = '\0';
+    e.ready.store(true, std::memory_order_release);
+}
+
+size_t Tracer::size() const {
+    return std::min(next_.load(std::memory_order_relaxed), capacity_);
+}
+
+void Tracer::clear() {
+    for (size_t i = 0; i < size(); ++i) {
+        entries_[i].ready.store(false, std::memory_order_relaxed);
+    }
+    next_.store(0, std::memory_order_relaxed);
+    dropped_.store(0, std::memory_order_relaxed);
+}
+
+void Tracer::exportChromeTrace(std::ostream& out) const {
+    const size_t n = size();
+
+    // Zaman damgaları ilk olaya göre göreli yazılır (mikrosaniye)
+    int64_t origin = INT64_MAX;
+    for (size_t i = 0; i < n; ++i) {
+        if (entries_[i].ready.load(std::memory_order_acquire)) {
+            origin = std::min(origin, entries_[i].ts_ns);
+        }
+    }
+
+    std::ios::fmtflags flags = out.flags();
+    out << std::fixed << std::setprecision(3);
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (size_t i = 0; i < n; ++i) {
+        const Entry& e = entries_[i];
+        if (!e.ready.load(std::memory_order_acquire)) continue;
+
+        if (!first) out << ",\n";
+        first = false;
+
+        out << "{\"name\":";
+        writeJsonString(out, e.name[0] ? e.name : labelOf(e.event));
+        out << ",\"cat\":\"" << labelOf(e.event) << "\""
+            << ",\"ph\":\"" << phaseOf(e.event) << "\"";
+        if (e.event != TraceEvent::Start && e.event != TraceEvent::End) {
+            out << ",\"s\":\"t\"";
+        }
+        out << ",\"ts\":" << (e.ts_ns - origin) / 1000.0
+            << ",\"pid\":1,\"tid\":" << e.tid
+            << ",\"args\":{\"task_id\":" << e.task_id << ",\"cpu\":" << e.cpu;
+        if (e.arg >= 0) out << ",\"arg\":" << e.arg;
+        out << "}}";
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+    out.flags(flags);
+}
+
+bool Tracer::exportChromeTrace(const std::string& path) const {
+    std::ofstream out(path);
+    if (!out) return false;
+    exportChromeTrace(out);
+    return static_cast<bool>(out);
+}
+
+} // namespace jts
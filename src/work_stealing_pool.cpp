@@ -0,0 +1,264 @@
+#include "work_stealing_pool.hpp"
+#include "cpu_utils.hpp"
+#include "logger.hpp"
+#include "trace.hpp"
+
+namespace jts {
+
+namespace {
+
+// Mevcut thread hangi havuzun kaçıncı worker'ı (havuz dışıysa nullptr)
+thread_local const WorkStealingPool* tlsPool = nullptr;
+thread_local size_t tlsIndex = 0;
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// WorkStealingDeque
+// ---------------------------------------------------------------------------
+
+WorkStealingDeque::Array::Array(int64_t cap)
+    : capacity(cap), mask(cap - 1), slots(new std::atomic<Job*>[cap]) {}
+
+WorkStealingDeque::WorkStealingDeque(int64_t capacity) {
+    // Kapasite 2'nin kuvveti olmalı (indeks maskeleme için)
+    int64_t cap = 1;
+    while (cap < capacity) cap <<= 1;
+    retired_.push_back(std::make_unique<Array>(cap));
+    array_.store(retired_.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+    // Kalan işleri serbest bırak
+    while (Job* job = pop()) {
+        delete job;
+    }
+}
+
+WorkStealingDeque::Array* WorkStealingDeque::grow(Array* old, int64_t bottom, int64_t top) {
+    auto bigger = std::make_unique<Array>(old->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i) {
+        bigger->put(i, old->get(i));
+    }
+    Array* raw = bigger.get();
+    retired_.push_back(std::move(bigger));
+    array_.store(raw, std::memory_order_release);
+    return raw;
+}
+
+void WorkStealingDeque::push(Job* job) {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_acquire);
+    Array* a = array_.load(std::memory_order_relaxed);
+
+    if (b - t > a->capacity - 1) {
+        a = grow(a, b, t);
+    }
+    a->put(b, job);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::Job* WorkStealingDeque::pop() {
+    int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* a = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // Boş
+        bottom_.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = a->get(b);
+    if (t == b) {
+        // Son eleman: hırsızlarla yarış
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+WorkStealingDeque::Job* WorkStealingDeque::steal() {
+    int64_t t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom_.load(std::memory_order_acquire);
+
+    if (t >= b) return nullptr;
+
+    Array* a = array_.load(std::memory_order_acquire);
+    Job* job = a->get(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return nullptr;  // Başka bir hırsız veya sahip kazandı
+    }
+    return job;
+}
+
+size_t WorkStealingDeque::size() const {
+    int64_t b = bottom_.load(std::memory_order_relaxed);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0;
+}
+
+// ---------------------------------------------------------------------------
+// WorkStealingPool
+// ---------------------------------------------------------------------------
+
+WorkStealingPool::WorkStealingPool(size_t numThreads) {
+    if (numThreads == 0) {
+        numThreads = static_cast<size_t>(getCpuCount());
+    }
+
+    JTS_LOG_INFO("[WorkStealingPool] %zu worker başlatılıyor", numThreads);
+
+    for (size_t i = 0; i < numThreads; ++i) {
+        auto state = std::make_unique<WorkerState>();
+        state->rng.seed(static_cast<unsigned>(i + 1));
+        states_.push_back(std::move(state));
+    }
+    for (size_t i = 0; i < numThreads; ++i) {
+        workers_.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    shutdown();
+    for (Job* job : inject_) {
+        delete job;
+    }
+}
+
+void WorkStealingPool::enqueue(std::function<void()> job) {
+    Job* boxed = new Job(std::move(job));
+    outstanding_.fetch_add(1);
+
+    // pending_ önce artar: bir hırsız işi alıp azaltmadan önce sayılmış olmalı
+    pending_.fetch_add(1);
+
+    if (tlsPool == this) {
+        // Havuz içinden: kendi kuyruğuna, kilitsiz
+        states_[tlsIndex]->deque.push(boxed);
+    } else {
+        std::lock_guard<std::mutex> lock(injectMutex_);
+        inject_.push_back(boxed);
+        injectSize_.fetch_add(1, std::memory_order_release);
+    }
+
+    JTS_TRACE(TraceEvent::Enqueue, 0, "pool_job");
+
+    // Uyuyan worker varsa birini uyandır. idle_ ve pending_ seq_cst olduğu
+    // için ya worker yeni işi görür ya da biz onun idle olduğunu görürüz.
+    if (idle_.load() > 0) {
+        { std::lock_guard<std::mutex> lock(sleepMutex_); }
+        sleepCv_.notify_one();
+    }
+}
+
+void WorkStealingPool::waitIdle() {
+    idleWaiters_.fetch_add(1);
+    {
+        std::unique_lock<std::mutex> lock(idleMutex_);
+        idleCv_.wait(lock, [this]() { return outstanding_.load() == 0; });
+    }
+    idleWaiters_.fetch_sub(1);
+}
+
+size_t WorkStealingPool::pending() const {
+    return pending_.load();
+}
+
+void WorkStealingPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    sleepCv_.notify_all();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
+WorkStealingPool::Job* WorkStealingPool::popInject() {
+    if (injectSize_.load(std::memory_order_acquire) == 0) return nullptr;
+
+    std::lock_guard<std::mutex> lock(injectMutex_);
+    if (inject_.empty()) return nullptr;
+    Job* job = inject_.front();
+    inject_.pop_front();
+    injectSize_.fetch_sub(1, std::memory_order_relaxed);
+    return job;
+}
+
+WorkStealingPool::Job* WorkStealingPool::findJob(size_t index) {
+    WorkerState& self = *states_[index];
+
+    // 1. Kendi kuyruğu (LIFO, cache sıcak)
+    if (Job* job = self.deque.pop()) return job;
+
+    // 2. Havuz dışından gelenler
+    if (Job* job = popInject()) return job;
+
+    // 3. Rastgele bir kurbandan başlayarak diğerlerinden çal (FIFO)
+    const size_t n = states_.size();
+    if (n > 1) {
+        size_t start = self.rng() % n;
+        for (size_t k = 0; k < n; ++k) {
+            size_t victim = (start + k) % n;
+            if (victim == index) continue;
+            if (Job* job = states_[victim]->deque.steal()) return job;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingPool::workerLoop(size_t index) {
+    tlsPool = this;
+    tlsIndex = index;
+
+    while (true) {
+        if (Job* job = findJob(index)) {
+            pending_.fetch_sub(1);
+            JTS_TRACE(TraceEvent::Start, 0, "pool_job");
+            (*job)();
+            JTS_TRACE(TraceEvent::End, 0, "pool_job");
+            delete job;
+            // seq_cst: bekleyen ya sıfırı görür ya da biz onu görürüz
+            if (outstanding_.fetch_sub(1) == 1 && idleWaiters_.load() > 0) {
+                std::lock_guard<std::mutex> lock(idleMutex_);
+                idleCv_.notify_all();
+            }
+            continue;
+        }
+
+        // Bir yerde iş var ama henüz görünür değil (çalma yarışı) -> tekrar dene
+        if (pending_.load() > 0) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (stop_) break;
+
+        idle_.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            sleepCv_.wait(lock, [this]() {
+                return stop_ || pending_.load() > 0;
+            });
+        }
+        idle_.fetch_sub(1);
+    }
+
+    tlsPool = nullptr;
+}
+
+} // namespace jts
@@ -0,0 +1,73 @@
+#include "alloc_counter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local bool counting = false;
+thread_local std::size_t count = 0;
+
+void* allocate(std::size_t size) noexcept {
+    if (counting) ++count;
+    return std::malloc(size ? size : 1);
+}
+
+void* allocateAligned(std::size_t size, std::align_val_t align) noexcept {
+    if (counting) ++count;
+    std::size_t a = static_cast<std::size_t>(align);
+    std::size_t rounded = (size + a - 1) / a * a;  // aligned_alloc: boyut hizanın katı
+    return std::aligned_alloc(a, rounded ? rounded : a);
+}
+} // namespace
+
+namespace alloc_counter {
+
+void start() {
+    count = 0;
+    counting = true;
+}
+
+std::size_t stop() {
+    counting = false;
+    return count;
+}
+
+} // namespace alloc_counter
+
+// Tüm biçimler birlikte değiştirilir: her new ile eşleşen delete free() çağırır
+void* operator new(std::size_t size) {
+    if (void* p = allocate(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    if (void* p = allocate(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t align) {
+    if (void* p = allocateAligned(size, align)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size, std::align_val_t align) {
+    if (void* p = allocateAligned(size, align)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, align);
+}
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept {
+    return allocateAligned(size, align);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { std::free(p); }
@@ -0,0 +1,17 @@
+#ifndef ALLOC_COUNTER_HPP
+#define ALLOC_COUNTER_HPP
+
+#include <cstddef>
+
+// Bu thread'deki heap allocation'larını say (sıfır-allocation testi için).
+// Global operator new/delete alloc_counter.cpp'de ayrı çeviri biriminde
+// değiştirilir: derleyici malloc/free gövdelerini çağıranlara satır içine
+// alamaz (-Wmismatched-new-delete yok).
+namespace alloc_counter {
+
+void start();        // Sayacı sıfırla ve saymaya başla
+std::size_t stop();  // Saymayı bırak, sayılan allocation'ları döndür
+
+} // namespace alloc_counter
+
+#endif
@@ -0,0 +1,185 @@
+// Gerçekçi senaryo testleri (README "Performans Sonuçları" bölümü)
+//
+// 1. Öncelik sıralaması (tek thread, runOnce)
+// 2. Realtime görev, yüksek öncelikli normal görevden önce
+// 3. ThreadPool ile paralel / seri süre karşılaştırması
+// 4. CPU affinity
+// 5. MetricsCollector ile görev süreleri
+//
+// Başarısız test varsa çıkış kodu 1
+#include "scheduler.hpp"
+#include "thread_pool.hpp"
+#include "metrics.hpp"
+#include "cpu_utils.hpp"
+#include "logger.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const std::string& pass, const std::string& fail) {
+    if (ok) {
+        std::cout << "✓ BAŞARILI: " << pass << "\n";
+    } else {
+        std::cout << "✗ BAŞARISIZ: " << fail << "\n";
+        failures++;
+    }
+}
+
+std::string joinOrder(const std::vector<std::string>& order) {
+    std::string out;
+    for (const auto& name : order) out += name + " -> ";
+    return out + "bitti";
+}
+
+jts::Task makeTask(const std::string& name, int priority, bool realtime,
+                   std::vector<std::string>& order) {
+    jts::Task t;
+    t.name = name;
+    t.priority = priority;
+    t.realtime = realtime;
+    t.work = [&order, name]() { order.push_back(name); };
+    return t;
+}
+
+void testPriorityOrder() {
+    std::cout << "\n### Test 1: Öncelik Sıralaması\n";
+    jts::Scheduler s;
+    std::vector<std::string> order;
+    s.addTask(makeTask("low_priority", 2, false, order));
+    s.addTask(makeTask("high_priority", 9, false, order));
+    s.addTask(makeTask("medium_priority", 5, false, order));
+    while (s.runOnce()) {}
+
+    std::cout << "Çalışma sırası: " << joinOrder(order) << "\n";
+    check(order == std::vector<std::string>{"high_priority", "medium_priority", "low_priority"},
+          "Yüksek öncelikli görevler önce çalıştı!", "Öncelik sırası bozuk");
+}
+
+void testRealtimeFirst() {
+    std::cout << "\n### Test 2: Realtime Görev Önceliği\n";
+    jts::Scheduler s;
+    std::vector<std::string> order;
+    s.addTask(makeTask("normal_high", 10, false, order));
+    s.addTask(makeTask("realtime_low", 3, true, order));
+    while (s.runOnce()) {}
+
+    std::cout << "Çalışma sırası: " << joinOrder(order) << "\n";
+    check(order == std::vector<std::string>{"realtime_low", "normal_high"},
+          "Realtime görev her zaman önce çalışır!\n  (pri=3 realtime > pri=10 normal)",
+          "Realtime görev önce çalışmadı");
+}
+
+void testParallelSpeedup() {
+    std::cout << "\n### Test 3: Paralel vs Seri Karşılaştırma\n";
+    const int tasks = 8;
+    const auto work = std::chrono::milliseconds(100);
+    const int cores = jts::getCpuCount();
+    std::cout << "Görev sayısı: " << tasks << " x " << work.count() << "ms\n";
+    std::cout << "CPU çekirdek: " << cores << "\n\n";
+
+    auto t0 = Clock::now();
+    for (int i = 0; i < tasks; ++i) std::this_thread::sleep_for(work);
+    double serialMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    jts::ThreadPool pool(0);
+    t0 = Clock::now();
+    for (int i = 0; i < tasks; ++i) {
+        pool.submit([work]() { std::this_thread::sleep_for(work); });
+    }
+    pool.waitIdle();
+    double parallelMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    double speedup = serialMs / parallelMs;
+    std::cout << std::fixed << std::setprecision(0)
+              << "Seri süre:    " << serialMs << " ms\n"
+              << "Paralel süre: " << parallelMs << " ms\n"
+              << std::setprecision(2) << "Hız artışı:   " << speedup << "x\n";
+    if (cores < 2) {
+        std::cout << "- ATLANDI: tek çekirdekte hız artışı beklenmez\n";
+        return;
+    }
+    // Havuz CPU sayısı kadar thread: beklenen ~min(cores, tasks) kat; yarısı yeter
+    double expected = std::min(cores, tasks) / 2.0;
+    std::ostringstream pass;
+    pass << "ThreadPool " << speedup << "x hız artışı sağladı!";
+    check(speedup >= expected, pass.str(), "Paralel çalışma beklenenden yavaş");
+}
+
+void testAffinity() {
+    std::cout << "\n### Test 4: CPU Affinity\n";
+    std::cout << "Mevcut CPU sayısı: " << jts::getCpuCount() << "\n";
+    std::vector<int> cores = {0, 1};
+    if (jts::getCpuCount() < 2) cores = {0};
+
+    bool pinned = false;
+    std::thread t([&]() { pinned = jts::setCurrentThreadAffinity(cores); });
+    t.join();
+    if (pinned) {
+        std::cout << "✓ Thread çekirdek " << (cores.size() == 2 ? "0-1'e" : "0'a") << " bağlandı\n"
+                  << "  Avantajlar:\n"
+                  << "  - Cache locality (L1/L2 cache verileri korunur)\n"
+                  << "  - Realtime görevler izole edilebilir\n"
+                  << "  - GPU thread'leri ayrı çekirdeklere atanabilir\n";
+    } else {
+        // Kısıtlı ortam (container, affinity maskesi): hata değil
+        std::cout << "- ATLANDI: sched_setaffinity izin vermedi\n";
+    }
+}
+
+void testMetrics() {
+    std::cout << "\n### Test 5: Task Metrics\n";
+    jts::MetricsCollector metrics;
+    struct Stage { const char* name; int ms; };
+    const Stage stages[] = {
+        {"camera_capture", 50}, {"ai_inference", 100}, {"object_tracking", 75}, {"log_write", 25}};
+
+    uint64_t id = 1;
+    for (const auto& stage : stages) {
+        auto token = metrics.recordStart(id++, stage.name);
+        std::this_thread::sleep_for(std::chrono::milliseconds(stage.ms));
+        metrics.recordEnd(token, true);
+    }
+
+    double total = 0;
+    bool ok = true;
+    std::vector<jts::TaskMetrics> all = metrics.getAll();
+    std::cout << std::fixed << std::setprecision(2);
+    for (const auto& m : all) {
+        std::cout << m.task_name << ": " << m.duration_ms << "ms\n";
+        total += m.duration_ms;
+    }
+    for (size_t i = 0; i < all.size() && i < 4; ++i) {
+        ok = ok && all[i].duration_ms >= stages[i].ms;
+    }
+    std::cout << "TOTAL: " << total << "ms\n";
+    check(all.size() == 4 && ok, "Süreler kaydedildi", "Eksik ya da kısa kayıt");
+}
+
+} // namespace
+
+int main() {
+    // Scheduler logları test çıktısını bozmasın
+    jts::Logger::instance().setLevel(jts::LogLevel::Warn);
+
+    std::cout << "=== Gerçekçi Senaryo Testleri ===\n";
+    testPriorityOrder();
+    testRealtimeFirst();
+    testParallelSpeedup();
+    testAffinity();
+    testMetrics();
+
+    std::cout << "\n" << (failures == 0 ? "Tüm testler başarılı" : "Başarısız test var")
+              << " (" << failures << " hata)\n";
+    return failures == 0 ? 0 : 1;
+}
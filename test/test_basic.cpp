@@ -1,7 +1,48 @@
 #include "task.hpp"
 #include "task_registry.hpp"
+#include "scheduler.hpp"
+#include "work_stealing_pool.hpp"
+#include "metrics.hpp"
+#include "histogram.hpp"
+#include "trace.hpp"
+#include "logger.hpp"
+#include "task_graph.hpp"
+#include "thread_pool.hpp"
+#include "pipeline.hpp"
+#include "future.hpp"
+#include "topology.hpp"
+#include "timing_wheel.hpp"
+#include "async_io.hpp"
+#include "cpu_utils.hpp"
+#include "slab_pool.hpp"
+#include "alloc_counter.hpp"
+#if defined(__cpp_impl_coroutine)
+#include "coro.hpp"
+#endif
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <stdexcept>
+#include <cmath>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <iostream>
+#include <thread>
+#include <cstdlib>
+#include <random>
+#include <climits>
+#include <functional>
+#include <algorithm>
+#include <new>
+#include <sched.h>
+#include <fstream>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 void testTaskCreation() {
     jts::Task t;
@@ -29,13 +70,1716 @@ void testRegistry() {
     
     reg.removeTask(id);
     assert(reg.count() == 0);
+
+    // CpuMask'e sığmayan çekirdek "tüm çekirdekler"e dönüşmez: kayıt reddedilir
+    jts::Task far = t;
+    far.cpu_cores = {70};
+    assert(!far.isValid());
+    assert(reg.registerTask(far) == 0);
+    auto ids = reg.registerTasks({t, far});
+    assert(ids.size() == 2 && ids[0] != 0 && ids[1] == 0);
+    assert(reg.count() == 1);
+    jts::Scheduler s;
+    assert(s.addTask(far) == 0);
+    assert(s.pendingCount() == 0);
     std::cout << "[PASS] Registry\n";
 }
 
+void testRegistryPopOrder() {
+    jts::TaskRegistry reg;
+    jts::Task low, high, rt, highLater;
+    low.name = "low";            low.priority = 1;
+    high.name = "high";          high.priority = 9;
+    rt.name = "rt";              rt.priority = 2;  rt.realtime = true;
+    highLater.name = "high2";    highLater.priority = 9;
+
+    reg.registerTask(low);
+    reg.registerTask(high);
+    uint64_t rtId = reg.registerTask(rt);
+    reg.registerTask(highLater);
+
+    // Ortadan silme heap'i bozmamalı
+    uint64_t extra = reg.registerTask(low);
+    assert(reg.removeTask(extra));
+    assert(!reg.removeTask(extra));
+    assert(reg.getTask(rtId)->name == "rt");
+
+    assert(reg.popHighest()->name == "rt");     // realtime her zaman önce
+    assert(reg.popHighest()->name == "high");   // eşit öncelikte FIFO
+    assert(reg.popHighest()->name == "high2");
+    assert(reg.popHighest()->name == "low");
+    assert(!reg.popHighest().has_value());
+    assert(reg.count() == 0);
+
+    // Rastgele anahtarlar + ortadan silme: 4'lü heap referans sıralamayla aynı
+    std::mt19937 rng(7);
+    std::vector<jts::Task> expected;
+    std::vector<uint64_t> removed;
+    for (int i = 0; i < 500; ++i) {
+        jts::Task t;
+        t.name = "rnd";
+        t.priority = static_cast<int>(rng() % 11);
+        t.realtime = rng() % 8 == 0;
+        t.deadline = std::chrono::microseconds(rng() % 4 == 0 ? 0 : 1 + rng() % 50);
+        t.id = reg.registerTask(t);
+        if (i % 7 == 3) {
+            removed.push_back(t.id);
+        } else {
+            expected.push_back(t);
+        }
+    }
+    for (uint64_t id : removed) assert(reg.removeTask(id));
+    auto deadlineOf = [](const jts::Task& t) {
+        return t.deadline.count() > 0 ? t.deadline.count() : INT64_MAX;
+    };
+    std::sort(expected.begin(), expected.end(), [&](const jts::Task& a, const jts::Task& b) {
+        if (a.realtime != b.realtime) return a.realtime;
+        if (a.priority != b.priority) return a.priority > b.priority;
+        if (deadlineOf(a) != deadlineOf(b)) return deadlineOf(a) < deadlineOf(b);
+        return a.id < b.id;
+    });
+    for (const auto& t : expected) assert(reg.popHighest()->id == t.id);
+    assert(reg.count() == 0);
+    std::cout << "[PASS] Registry pop order\n";
+}
+
+void testMultiWorkerAffinity() {
+    jts::Scheduler s(2);
+    assert(s.workerCount() == 2);
+
+    std::atomic<int> done{0};
+    std::atomic<int> wrongCore{0};
+    for (int i = 0; i < 8; ++i) {
+        jts::Task t;
+        t.name = "pinned";
+        t.cpu_cores = {0};
+        t.work = [&]() {
+            if (sched_getcpu() != 0) wrongCore++;
+            done++;
+        };
+        s.addTask(t);
+    }
+    s.start();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (done < 8 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    s.stop();
+
+    assert(done == 8);
+    assert(wrongCore == 0);
+    assert(s.pendingCount() == 0);
+
+    // SCHED_FIFO yükseltmesi kalıcı değil: sonraki normal görev SCHED_OTHER'da
+    jts::Scheduler one(1);
+    one.start();
+    jts::Task rt(0, "rt", jts::TaskType::CPU, 5);
+    rt.realtime = true;
+    int rtPolicy = -1;
+    int normalPolicy = -1;
+    one.submit(rt, [&rtPolicy]() { rtPolicy = sched_getscheduler(0); }).get();
+    one.submit(jts::Task(0, "normal", jts::TaskType::CPU, 5),
+               [&normalPolicy]() { normalPolicy = sched_getscheduler(0); }).get();
+    one.stop();
+    assert(rtPolicy == SCHED_FIFO || rtPolicy == SCHED_OTHER);  // Yetki yoksa OTHER
+    assert(normalPolicy == SCHED_OTHER);
+    std::cout << "[PASS] Multi-worker affinity\n";
+}
+
+void testExecutionDomains() {
+    jts::MetricsCollector metrics;
+    jts::SchedulerOptions opts;
+    opts.cpu.workers = 1;
+    opts.io.workers = 2;
+    opts.metrics = &metrics;
+    jts::Scheduler s(opts);
+    assert(s.workerCount() == 4);  // 1 CPU + 2 IO + 1 GPU
+    assert(s.domainStats(jts::TaskType::GPU).workers == 1);
+    s.start();
+
+    // Bloklanan IO görevi CPU görevlerini bekletmez
+    jts::Promise<void> diskReady;
+    jts::Future<void> disk = diskReady.getFuture();
+    jts::Task io;
+    io.name = "disk_read";
+    io.type = jts::TaskType::IO;
+    uint64_t ioId = s.addTask(io, [disk]() mutable { disk.wait(); });
+
+    std::atomic<int> cpuRuns{0};
+    jts::Task cpu;
+    cpu.name = "compute";
+    std::vector<uint64_t> cpuIds;
+    for (int i = 0; i < 5; ++i) {
+        cpuIds.push_back(s.addTask(cpu, [&cpuRuns]() { cpuRuns++; }));
+    }
+    assert(s.waitFor(cpuIds, std::chrono::seconds(5)));
+    assert(cpuRuns == 5);
+    assert(s.registry().contains(ioId));  // Hâlâ diskte
+
+    // GPU: tek gönderim thread'i, görevler dağıtım sırasıyla ve birer birer
+    std::mutex orderMutex;
+    std::vector<int> order;
+    std::atomic<int> inFlight{0};
+    std::atomic<int> overlap{0};
+    jts::Task gpu;
+    gpu.name = "kernel";
+    gpu.type = jts::TaskType::GPU;
+    std::vector<jts::Task> kernels(6, gpu);
+    for (int i = 0; i < 6; ++i) {
+        kernels[i].work = [&, i]() {
+            if (inFlight.fetch_add(1) != 0) overlap++;
+            std::this_thread::sleep_for(std::chrono::microseconds(300));
+            {
+                std::lock_guard<std::mutex> lock(orderMutex);
+                order.push_back(i);
+            }
+            inFlight--;
+        };
+    }
+    s.wait(s.addTasks(std::move(kernels)));
+    assert(overlap == 0);
+    assert((order == std::vector<int>{0, 1, 2, 3, 4, 5}));
+
+    diskReady.setValue();
+    s.wait(ioId);
+    s.stop();
+
+    jts::DomainStats cpuStats = s.domainStats(jts::TaskType::CPU);
+    jts::DomainStats ioStats = s.domainStats(jts::TaskType::IO);
+    jts::DomainStats gpuStats = s.domainStats(jts::TaskType::GPU);
+    assert(cpuStats.executed == 5 && ioStats.executed == 1 && gpuStats.executed == 6);
+    assert(cpuStats.queued == 0 && gpuStats.max_queued >= 1);
+    assert(ioStats.busy_ms > 0.0);
+
+    size_t gpuRecords = 0;
+    for (const auto& st : metrics.latencyStats()) {
+        if (st.task_name == "domain.GPU") gpuRecords = st.count;
+    }
+    assert(gpuRecords == 6);
+
+    // Scheduler(n): alan yok, IO görevi CPU worker'larında çalışır
+    jts::Scheduler plain(1);
+    plain.start();
+    plain.wait(plain.addTask(io, []() {}));
+    plain.stop();
+    assert(plain.domainStats(jts::TaskType::IO).workers == 0);
+    assert(plain.domainStats(jts::TaskType::CPU).executed == 1);
+    std::cout << "[PASS] Execution domains\n";
+}
+
+void testWorkStealingPool() {
+    std::atomic<int> done{0};
+    {
+        jts::WorkStealingPool pool(3);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&pool, &done]() {
+                for (int j = 0; j < 10; ++j) {
+                    pool.submit([&done]() { done++; });
+                }
+                done++;
+            });
+        }
+        // Yıkıcı (shutdown) kuyruktaki işleri bitirir
+    }
+    assert(done == 100 * 11);
+    std::cout << "[PASS] Work-stealing pool\n";
+}
+
+void testEdfOrder() {
+    jts::TaskRegistry reg;
+    auto now = std::chrono::steady_clock::now();
+
+    jts::Task late, early, none;
+    late.name = "late";    late.deadline = std::chrono::milliseconds(50);
+    early.name = "early";  early.deadline = std::chrono::milliseconds(5);
+    none.name = "none";
+    late.release_time = early.release_time = none.release_time = now;
+
+    reg.registerTask(none);
+    reg.registerTask(late);
+    reg.registerTask(early);
+
+    // Aynı öncelik bandında en erken son tarih önce, son tarihsiz en son
+    assert(reg.popHighest()->name == "early");
+    assert(reg.popHighest()->name == "late");
+    assert(reg.popHighest()->name == "none");
+    std::cout << "[PASS] EDF order\n";
+}
+
+void testPeriodicTask() {
+    jts::Scheduler s;
+    std::atomic<int> runs{0};
+
+    jts::Task sensor;
+    sensor.name = "sensor";
+    sensor.period = std::chrono::milliseconds(5);
+    sensor.work = [&]() { runs++; };
+    uint64_t id = s.addTask(sensor);
+
+    jts::Task slow;
+    slow.name = "slow";
+    slow.period = std::chrono::milliseconds(20);
+    slow.deadline = std::chrono::milliseconds(1);
+    slow.work = [] { std::this_thread::sleep_for(std::chrono::milliseconds(2)); };
+    uint64_t slowId = s.addTask(slow);
+
+    s.start();
+    // Görev çalışırken de sayaçlar okunabilir (complete() kilit altında yazar)
+    uint64_t seenMisses = 0;
+    auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(60);
+    while (std::chrono::steady_clock::now() < until) {
+        auto snap = s.registry().getTask(slowId);
+        if (snap) {
+            assert(snap->deadline_misses >= seenMisses);
+            assert(snap->max_runtime.count() == 0 || snap->max_runtime.count() >= 1000);
+            seenMisses = snap->deadline_misses;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    assert(seenMisses >= 1);
+    assert(s.cancelTask(id));
+    assert(s.cancelTask(slowId));
+    int after = runs;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    s.stop();
+
+    // 60ms / 5ms ~ 12 aktivasyon; yavaş sistemler için geniş aralık
+    assert(after >= 5 && after <= 14);
+    assert(runs <= after + 1);          // İptalden sonra yeniden kurulmadı
+    assert(s.deadlineMisses() >= 2);    // "slow" her aktivasyonda kaçırır
+    assert(s.pendingCount() == 0);
+    std::cout << "[PASS] Periodic task\n";
+}
+
+jts::Task budgeted(const char* name, int wcetUs, int periodUs) {
+    jts::Task t;
+    t.name = name;
+    t.wcet = std::chrono::microseconds(wcetUs);
+    t.period = std::chrono::microseconds(periodUs);
+    return t;
+}
+
+void testAdmissionControl() {
+    auto near = [](double a, double b) { return std::fabs(a - b) < 1e-6; };
+
+    // EDF, tek işlemci: U <= 1
+    {
+        jts::Scheduler s;
+        jts::AdmissionOptions edf;
+        edf.policy = jts::AdmissionPolicy::Edf;
+        s.setAdmission(edf);
+        uint64_t a = s.addTask(budgeted("a", 300, 1000));
+        assert(a != 0);
+        assert(s.addTask(budgeted("b", 300, 1000)) != 0);
+        assert(s.addTask(budgeted("c", 400, 1000)) != 0);          // Tam dolu: 1.0
+        assert(s.addTask(budgeted("d", 100, 1000)) == 0);          // Sığmaz
+        assert(s.addTask(budgeted("oneshot", 5000, 0)) != 0);      // Periyodik değil: sınanmaz
+        assert(near(s.reservedUtilization(-1), 1.0));
+        assert(s.cancelTask(a));                                   // Pay geri verilir
+        assert(near(s.reservedUtilization(-1), 0.7));
+        jts::Task tight = budgeted("tight", 200, 2000);
+        tight.deadline = std::chrono::microseconds(500);            // Yoğunluk: 200/500
+        assert(s.addTask(tight) == 0);
+        tight.deadline = std::chrono::microseconds(1000);
+        assert(s.addTask(tight) != 0);
+        jts::AdmissionStats st = s.admissionStats();
+        assert(st.admitted == 4 && st.rejected == 2 && st.demoted == 0);
+
+        // Registry üzerinden silme / temizleme de payı geri verir
+        uint64_t extra = s.addTask(budgeted("extra", 100, 1000));
+        assert(extra != 0 && near(s.reservedUtilization(-1), 1.0));
+        assert(s.registry().removeTask(extra));
+        assert(near(s.reservedUtilization(-1), 0.9));
+        s.registry().clear();
+        assert(near(s.reservedUtilization(-1), 0.0));
+        assert(s.addTask(budgeted("after_clear", 1000, 1000)) != 0);
+    }
+
+    // Liu-Layland: 4 x 0.25 = 1.0 > 4 (2^(1/4) - 1) ~ 0.757, EDF'de sığardı
+    {
+        jts::SchedulerOptions opts;
+        opts.cpu.workers = 1;
+        opts.io.disabled = true;
+        opts.gpu.disabled = true;
+        opts.admission.policy = jts::AdmissionPolicy::RateMonotonic;
+        jts::Scheduler s(opts);
+        for (int i = 0; i < 3; ++i) assert(s.addTask(budgeted("rm", 250, 1000)) != 0);
+        assert(s.addTask(budgeted("rm", 250, 1000)) == 0);
+
+        // Reddetmek yerine indir: realtime kalkar, öncelik 1'e iner, pay ayrılmaz
+        s.setAdmission({jts::AdmissionPolicy::RateMonotonic, jts::AdmissionAction::Demote, 1.0, 1});
+        jts::Task brake = budgeted("brake", 250, 1000);
+        brake.realtime = true;
+        brake.priority = 9;
+        uint64_t id = s.addTask(brake);
+        assert(id != 0);
+        auto demoted = s.registry().getTask(id);
+        assert(demoted && !demoted->realtime && demoted->priority == 1);
+        assert(s.admissionStats().demoted == 1);
+    }
+
+    // Bölümlenmiş: görev sınavı geçen en boş çekirdeğe atanır ve orada kalır
+    {
+        jts::SchedulerOptions opts;
+        opts.cpu.workers = 2;
+        opts.cpu.cores = {0, 1};
+        opts.io.workers = 2;               // Sabitlenmemiş: küresel küme (m = 2)
+        opts.gpu.disabled = true;
+        opts.admission.policy = jts::AdmissionPolicy::Edf;
+        jts::Scheduler s(opts);
+
+        uint64_t first = s.addTask(budgeted("cam", 600, 1000));
+        uint64_t second = s.addTask(budgeted("lidar", 600, 1000));
+        assert(first != 0 && second != 0);
+        assert(s.registry().getTask(first)->cpu_cores == std::vector<int>{0});
+        assert(s.registry().getTask(second)->cpu_cores == std::vector<int>{1});
+        assert(s.addTask(budgeted("fusion", 600, 1000)) == 0);     // İki çekirdek de dolu
+
+        jts::Task pinned = budgeted("imu", 300, 1000);
+        pinned.cpu_cores = {1};
+        assert(s.addTask(pinned) != 0);
+        pinned.wcet = std::chrono::microseconds(200);               // Çekirdek 0'da yer var ama
+        assert(s.addTask(pinned) == 0);                             // affinity 1'de ısrar eder
+        assert(near(s.reservedUtilization(0), 0.6));
+        assert(near(s.reservedUtilization(1), 0.9));
+
+        // Küresel EDF: 0.6 + 0.6 <= 2 - 0.6, üçüncüsü sığmaz
+        jts::Task log = budgeted("log", 600, 1000);
+        log.type = jts::TaskType::IO;
+        assert(s.addTask(log) != 0);
+        assert(s.addTask(log) != 0);
+        assert(s.addTask(log) == 0);
+        assert(near(s.reservedUtilization(-1), 1.2));
+    }
+
+    // Bütçe takibi: ölçülen süre wcet'i aşarsa görev ve alan başına sayılır
+    {
+        jts::SchedulerOptions opts;
+        opts.cpu.workers = 1;
+        opts.io.disabled = true;
+        opts.gpu.disabled = true;
+        jts::Scheduler s(opts);
+        jts::Task greedy = budgeted("greedy", 1000, 10000);
+        greedy.work = [] { std::this_thread::sleep_for(std::chrono::milliseconds(3)); };
+        jts::Task frugal = budgeted("frugal", 50000, 100000);
+        frugal.work = [] {};
+        uint64_t g = s.addTask(greedy);
+        uint64_t f = s.addTask(frugal);
+        s.start();
+        while (s.domainStats(jts::TaskType::CPU).executed < 4) {  // greedy >= 3 kez
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        assert(s.cancelTask(g));
+        assert(s.cancelTask(f));
+        s.waitIdle();
+        s.stop();
+        uint64_t overruns = s.admissionStats().budget_overruns;
+        assert(overruns >= 3);
+        assert(s.domainStats(jts::TaskType::CPU).budget_overruns == overruns);
+    }
+
+    // Görev başına sayaç ve ölçülen en uzun süre (tek thread modu)
+    {
+        jts::Scheduler s;
+        jts::Task greedy = budgeted("greedy", 1000, 50000);
+        greedy.work = [] { std::this_thread::sleep_for(std::chrono::milliseconds(2)); };
+        uint64_t id = s.addTask(greedy);
+        assert(s.runOnce());
+        auto t = s.registry().getTask(id);
+        assert(t->budget_overruns == 1);
+        assert(t->max_runtime >= std::chrono::milliseconds(2));
+        assert(!budgeted("impossible", 2000, 1000).isValid());    // wcet > periyot
+    }
+    std::cout << "[PASS] Admission control and CPU budgets\n";
+}
+
+void testTimingWheel() {
+    struct Item : jts::TimerLink {
+        int64_t due = 0;
+        bool queued = false;
+        int fired = 0;
+    };
+    std::mt19937 rng(7);
+    std::vector<Item> items(2000);
+    jts::TimingWheel wheel(1000);
+    int64_t now = 1000;
+    size_t queued = 0;
+
+    for (int round = 0; round < 400; ++round) {
+        // Rastgele ekle / iptal et: yakın (alt seviye) ve uzak (cascade) anlar
+        for (int k = 0; k < 20; ++k) {
+            Item& it = items[rng() % items.size()];
+            if (it.queued) {
+                wheel.remove(&it);
+                it.queued = false;
+                queued--;
+            } else {
+                int64_t span = rng() % 4 == 0 ? 5000000 : 5000;
+                it.due = now + 1 + static_cast<int64_t>(rng() % span);
+                assert(wheel.insert(&it, it.due));
+                it.queued = true;
+                queued++;
+            }
+        }
+        assert(wheel.size() == queued);
+
+        // Bir sonraki an en erken öğeden geç olamaz
+        int64_t earliest = INT64_MAX;
+        for (const Item& it : items) {
+            if (it.queued) earliest = std::min(earliest, it.due);
+        }
+        auto next = wheel.nextExpiry();
+        assert(next.has_value() == (queued > 0));
+        if (next) assert(*next <= earliest);
+
+        now += static_cast<int64_t>(rng() % (round % 50 == 0 ? 2000000 : 3000));
+        wheel.advance(now, [&](jts::TimerLink* link) {
+            Item* it = static_cast<Item*>(link);
+            assert(it->queued && it->due <= now);  // Asla erken değil
+            it->queued = false;
+            it->fired++;
+            queued--;
+        });
+        for (const Item& it : items) {
+            assert(!it.queued || it.due > now);  // Zamanı gelen kalmadı
+        }
+    }
+    assert(!wheel.insert(&items[0], now));  // Geçmiş an eklenmez
+
+    wheel.advance(INT64_MAX / 2, [&](jts::TimerLink* link) {
+        static_cast<Item*>(link)->queued = false;
+        queued--;
+    });
+    assert(wheel.empty() && queued == 0);
+    std::cout << "[PASS] Timing wheel\n";
+}
+
+void testDelayedTasks() {
+    using namespace std::chrono;
+    // runOnce modu: zamanı gelmeden çalışmaz, iptal edilen hiç çalışmaz
+    {
+        jts::Scheduler s;
+        std::vector<int> order;
+        jts::Task t;
+        t.name = "later";
+        auto t0 = steady_clock::now();
+        s.addTaskAfter(t, [&order]() { order.push_back(2); }, milliseconds(20));
+        s.addTaskAt(t, [&order]() { order.push_back(1); }, t0 + milliseconds(10));
+        uint64_t dropped = s.addTaskAfter(t, [&order]() { order.push_back(3); }, milliseconds(15));
+        assert(!s.runOnce());
+        assert(s.pendingCount() == 3);
+        assert(s.cancelTask(dropped));  // Tekerlekte beklerken iptal
+        assert(s.pendingCount() == 2);
+
+        s.waitIdle();  // Çalışmıyor: bu thread'de en yakın ana kadar uyur
+        assert(steady_clock::now() - t0 >= milliseconds(20));
+        assert((order == std::vector<int>{1, 2}));
+    }
+
+    // start() modu: zamanlayıcı thread'i uyandırır; daha erken eklenen
+    // görev uzun bekleyen hedefi beklemez
+    {
+        jts::Scheduler s;
+        s.start();
+        std::atomic<int> late{0};
+        std::atomic<int64_t> firedAt{0};
+        jts::Task t;
+        t.name = "timer";
+        uint64_t far = s.addTaskAfter(t, [&late]() { late++; }, seconds(30));
+        auto t0 = steady_clock::now();
+        uint64_t soon = s.addTaskAfter(t, [&firedAt, t0]() {
+            firedAt = duration_cast<microseconds>(steady_clock::now() - t0).count();
+        }, milliseconds(5));
+        s.wait(soon);
+        assert(firedAt >= 5000);
+        assert(firedAt < 2000000);
+        assert(s.cancelTask(far));
+        assert(late == 0);
+        assert(s.pendingCount() == 0);
+        s.stop();
+    }
+
+    // Çoklu worker: geçmişteki an hemen hazır, faz tekerlekten geçer
+    {
+        jts::Scheduler s(2);
+        s.start();
+        std::atomic<int> runs{0};
+        jts::Task t;
+        t.name = "phase";
+        t.phase = milliseconds(3);
+        std::vector<uint64_t> ids;
+        ids.push_back(s.addTaskAt(t, [&runs]() { runs++; }, steady_clock::now() - seconds(1)));
+        ids.push_back(s.addTask(t, [&runs]() { runs++; }));
+        s.wait(ids);
+        assert(runs == 2);
+        s.stop();
+    }
+    std::cout << "[PASS] Delayed tasks\n";
+}
+
+void testMetricsRings() {
+    jts::MetricsCollector metrics(100);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&metrics, t]() {
+            for (int i = 0; i < 50; ++i) {
+                auto token = metrics.recordStart(t * 100 + i, "worker");
+                metrics.recordEnd(token);
+            }
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    // Çıkan thread'lerin halkaları toplayıcıda bırakılır, sayımları korunur
+    for (int i = 0; i < 200 && metrics.threadRings() != 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    assert(metrics.threadRings() == 0);
+    auto stats = metrics.latencyStats();
+    assert(stats.size() == 1 && stats[0].task_name == "worker" && stats[0].count == 200);
+
+    // Eski API: id ile kapatma; token ile kapatılan açılış tekrar kapanmaz
+    auto closed = metrics.recordStart(998, "legacy");
+    metrics.recordEnd(closed);
+    metrics.recordEnd(998);
+    metrics.recordStart(999, "legacy");
+    metrics.recordEnd(999, false);
+
+    auto all = metrics.getAll();
+    assert(all.size() == 100);             // Geçmiş sınırlı
+    assert(all.back().task_name == "legacy");
+    assert(!all.back().success);
+    assert(all[all.size() - 2].task_id == 998 && all[all.size() - 2].success);
+    assert(metrics.dropped() == 0);
+
+    metrics.clear();
+    assert(metrics.getAll().empty());
+    assert(metrics.latencyStats().empty());
+
+    // clear() sahip thread'lerin histogramlarına yazmaz: sonraki kayıtlar
+    // tabandan sayılır
+    std::thread after([&metrics]() {
+        for (int i = 0; i < 3; ++i) metrics.recordEnd(metrics.recordStart(i, "worker"));
+    });
+    after.join();
+    stats = metrics.latencyStats();
+    assert(stats.size() == 1 && stats[0].task_name == "worker" && stats[0].count == 3);
+    std::cout << "[PASS] Metrics rings\n";
+}
+
+void testHistogramPercentiles() {
+    jts::LatencyHistogram a, b;
+    for (int64_t v = 1; v <= 10000; ++v) {
+        (v % 2 ? a : b).record(v * 1000);  // 1us .. 10ms
+    }
+    a.merge(b);
+    assert(a.count() == 10000);
+    assert(a.max() == 10000 * 1000);
+
+    auto near = [](int64_t got, double want) {
+        return std::abs(got - want) <= want * 0.04;  // ~%3 kova hassasiyeti
+    };
+    assert(near(a.percentile(50), 5000e3));
+    assert(near(a.percentile(99), 9900e3));
+    assert(near(a.percentile(99.9), 9990e3));
+    assert(std::abs(a.mean() - 5000.5e3) < 1.0);
+    std::cout << "[PASS] Histogram percentiles\n";
+}
+
+void testLatencyWindow() {
+    using namespace std::chrono;
+    jts::MetricsCollector metrics(1000, milliseconds(5), milliseconds(10));
+
+    auto record = [&](int64_t ns) {
+        jts::MetricsToken t = metrics.recordStart(1, "stage");
+        t.start_ns -= ns;  // Süreyi yapay olarak ayarla
+        metrics.recordEnd(t);
+    };
+
+    for (int i = 0; i < 100; ++i) record(50000000);  // ~50ms
+    std::this_thread::sleep_for(milliseconds(100));   // Anlık görüntüler alınsın
+    for (int i = 0; i < 100; ++i) record(1000000);   // ~1ms
+
+    auto all = metrics.latencyStats();
+    assert(all.size() == 1 && all[0].count == 200);
+
+    auto recent = metrics.latencyStats(milliseconds(40));
+    assert(recent.size() == 1 && recent[0].count == 100);
+    assert(recent[0].p99_ms < 2.0);
+    std::cout << "[PASS] Latency window\n";
+}
+
+void testChromeTrace() {
+    auto& tracer = jts::Tracer::instance();
+    tracer.enable(64);
+    tracer.clear();
+
+    jts::Scheduler s;
+    jts::Task t;
+    t.name = "traced";
+    t.work = [] {};
+    uint64_t id = s.addTask(t);
+    assert(s.runOnce());
+    tracer.disable();
+
+    // Kapalıyken kayıt yapılmaz
+    s.addTask(t);
+    assert(tracer.size() == 4);  // enqueue, dispatch, start, end
+
+    std::ostringstream out;
+    tracer.exportChromeTrace(out);
+    std::string json = out.str();
+    assert(json.find("\"traceEvents\"") != std::string::npos);
+    assert(json.find("\"ph\":\"B\"") != std::string::npos);
+    assert(json.find("\"ph\":\"E\"") != std::string::npos);
+    assert(json.find("\"task_id\":" + std::to_string(id)) != std::string::npos);
+
+    // Dolu tampon: yeniden enable() yeni oturum başlatır, clear() gerekmez
+    tracer.enable(64);
+    for (int i = 0; i < 70; ++i) tracer.record(jts::TraceEvent::Enqueue, 1, "fill");
+    assert(tracer.size() == 64 && tracer.dropped() == 6);
+    tracer.disable();
+    tracer.enable(64);
+    assert(tracer.size() == 0 && tracer.dropped() == 0);
+    tracer.record(jts::TraceEvent::Enqueue, 1, "again");
+    assert(tracer.size() == 1);
+    tracer.disable();
+    tracer.clear();
+    std::cout << "[PASS] Chrome trace\n";
+}
+
+// Mesajları bellekte toplayan test hedefi
+struct CaptureSink : jts::LogSink {
+    std::mutex mutex;
+    std::vector<std::string> lines;
+    void write(jts::LogLevel, const char* message, size_t length) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        lines.emplace_back(message, length);
+    }
+};
+
+void testAsyncLogger() {
+    auto& logger = jts::Logger::instance();
+    auto sink = std::make_shared<CaptureSink>();
+    logger.setSink(sink);
+    logger.setLevel(jts::LogLevel::Debug);
+
+    // Scheduler'ın görev logları Debug seviyesinde sink'e ulaşır
+    jts::Scheduler s;
+    jts::Task t;
+    t.name = "logged";
+    t.work = [] {};
+    s.addTask(t);
+    assert(s.runOnce());
+
+    JTS_LOG_INFO("value=%d", 42);
+    JTS_LOG_TRACE("derleme zamanında elenir");
+    logger.setLevel(jts::LogLevel::Warn);
+    JTS_LOG_INFO("seviye altında");
+    logger.flush();
+
+    {
+        std::lock_guard<std::mutex> lock(sink->mutex);
+        bool sawRun = false, sawValue = false;
+        for (const auto& line : sink->lines) {
+            if (line.find("Çalıştırılıyor") != std::string::npos &&
+                line.find("logged") != std::string::npos) sawRun = true;
+            if (line == "value=42") sawValue = true;
+            assert(line.find("elenir") == std::string::npos);
+            assert(line.find("seviye altında") == std::string::npos);
+        }
+        assert(sawRun && sawValue);
+    }
+
+    logger.setSink(std::make_shared<jts::ConsoleSink>());
+    logger.setLevel(jts::LogLevel::Info);
+    std::cout << "[PASS] Async logger\n";
+}
+
+void testZeroAllocScheduling() {
+    jts::Scheduler s;
+    s.registry().reserve(64);
+
+    int runs = 0;
+    jts::Task desc;
+    desc.name = "hot";  // Kısa ad: std::string SSO, allocation yok
+
+    // Tek seferlik görevler: ekle + çalıştır
+    auto cycle = [&]() {
+        for (int i = 0; i < 32; ++i) {
+            s.addTask(desc, [&runs]() { runs++; });
+        }
+        while (s.runOnce()) {}
+    };
+    cycle();  // Isınma: ad tablosu, heap kapasitesi
+
+    alloc_counter::start();
+    cycle();
+    assert(alloc_counter::stop() == 0);
+    assert(runs == 64);
+
+    // Periyodik görev: her aktivasyonda yerinde yeniden kurulur
+    jts::Task tick;
+    tick.name = "tick";
+    tick.period = std::chrono::microseconds(1);
+    uint64_t id = s.addTask(tick, [&runs]() { runs++; });
+    for (int i = 0; i < 10; ++i) s.runOnce();
+
+    alloc_counter::start();
+    for (int i = 0; i < 200; ++i) s.runOnce();
+    assert(alloc_counter::stop() == 0);
+    assert(s.cancelTask(id));
+    assert(s.pendingCount() == 0);
+
+    // Büyük yakalamalar heap'e düşer, küçükler satır içinde kalır
+    char big[128] = {};
+    jts::TaskFunction small([&runs]() { runs++; });
+    jts::TaskFunction large([big]() { (void)big; });
+    assert(small.isInline());
+    assert(!large.isInline());
+
+    // Fırlatan kurucu havuzdan yer sızdırmaz
+    struct Picky {
+        explicit Picky(bool fail) {
+            if (fail) throw std::runtime_error("ctor");
+        }
+    };
+    jts::SlabPool<Picky, 2> pool;
+    Picky* first = pool.create(false);
+    bool threw = false;
+    try {
+        pool.create(true);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw && pool.live() == 1);
+    Picky* second = pool.create(false);
+    assert(pool.live() == 2 && pool.capacity() == 2);  // Yer yeniden kullanıldı
+    pool.destroy(first);
+    pool.destroy(second);
+    assert(pool.live() == 0);
+    std::cout << "[PASS] Zero-alloc scheduling\n";
+}
+
+void testAsyncIo() {
+    const size_t kBlocks = 200;
+    const size_t kBlock = 4096;
+    for (bool fallback : {false, true}) {
+        char path[] = "/tmp/jts_aio_XXXXXX";
+        int fd = mkstemp(path);
+        assert(fd >= 0);
+        unlink(path);
+
+        jts::SchedulerOptions opts;
+        opts.cpu.workers = 1;
+        opts.io.workers = 2;
+        jts::Scheduler s(opts);
+        s.start();
+
+        jts::AsyncIoOptions ioOpts;
+        ioOpts.entries = 64;  // 200 işlem: uçuş sınırında bekleme de denenir
+        ioOpts.forceFallback = fallback;
+        {
+            jts::AsyncIo io(s, ioOpts);
+            // io_uring'siz çekirdekte (veya seccomp) ilk tur da havuza düşer
+            if (fallback) assert(io.backend() == jts::IoBackend::ThreadPool);
+
+            // Yüzlerce eşzamanlı yazma; sonuçlar devam görevlerinde toplanır
+            std::vector<std::vector<char>> blocks(kBlocks);
+            std::atomic<size_t> written{0};
+            std::atomic<int> errors{0};
+            for (size_t i = 0; i < kBlocks; ++i) {
+                blocks[i].assign(kBlock, static_cast<char>('a' + i % 26));
+                io.write(fd, blocks[i].data(), kBlock, i * kBlock, [&](int64_t n) {
+                    if (n == static_cast<int64_t>(kBlock)) written += static_cast<size_t>(n);
+                    else errors++;
+                });
+            }
+            io.fsync(fd, [&](int64_t r) { if (r != 0) errors++; });
+            io.drain();
+            s.waitIdle();
+            assert(errors == 0);
+            assert(written == kBlocks * kBlock);
+
+            // Geri oku; devam görevi kendi tanımıyla (ad, tür) çalışır
+            std::vector<char> back(kBlocks * kBlock);
+            std::atomic<int> mismatched{0};
+            jts::Task verify;
+            verify.name = "verify";
+            verify.type = jts::TaskType::CPU;
+            for (size_t i = 0; i < kBlocks; ++i) {
+                char* dst = back.data() + i * kBlock;
+                io.read(fd, dst, kBlock, i * kBlock, verify, [&, dst, i](int64_t n) {
+                    if (n != static_cast<int64_t>(kBlock) ||
+                        dst[0] != 'a' + static_cast<int>(i % 26) || dst[kBlock - 1] != dst[0]) {
+                        mismatched++;
+                    }
+                });
+            }
+
+            // Hata -errno olarak devam görevine gelir
+            std::atomic<int64_t> badResult{0};
+            io.read(-1, back.data(), 16, 0, [&](int64_t n) { badResult = n; });
+            io.drain();
+            s.waitIdle();
+            assert(mismatched == 0);
+            assert(badResult == -EBADF);
+            assert(io.completed() == 2 * kBlocks + 2);
+            assert(io.inFlight() == 0);
+
+            // Periyodik followUp tek seferliğe çevrilir; reddedilen followUp
+            // done'ı kaybetmez
+            std::atomic<int> periodicCalls{0};
+            std::atomic<int> rejectedCalls{0};
+            jts::Task every = verify;
+            every.period = std::chrono::milliseconds(1);
+            every.phase = std::chrono::milliseconds(1);
+            io.fsync(fd, every, [&periodicCalls](int64_t) { periodicCalls++; });
+            jts::Task nowhere = verify;
+            nowhere.cpu_cores = {5000};
+            io.fsync(fd, nowhere, [&rejectedCalls](int64_t r) { if (r == 0) rejectedCalls++; });
+            io.drain();
+            s.waitIdle();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            assert(periodicCalls == 1 && rejectedCalls == 1);
+            assert(io.rejectedFollowUps() == 1);
+        }
+
+        // Yedek havuzdan fazla boşta sensör: poll'lar havuzu tutmaz, yazma
+        // ilerler; hazır olan poll tek başına biter, kalanlar iptal edilir
+        {
+            jts::AsyncIoOptions few = ioOpts;
+            few.fallbackThreads = 2;
+            const int kIdle = 6;
+            int pipes[kIdle][2];
+            std::atomic<int> cancelled{0};
+            std::atomic<int64_t> readable{0};
+            std::atomic<int64_t> wrote{0};
+            {
+                jts::AsyncIo io(s, few);
+                for (auto& p : pipes) {
+                    assert(pipe(p) == 0);
+                    io.poll(p[0], POLLIN, [&cancelled](int64_t r) {
+                        if (r == -ECANCELED) cancelled++;
+                    });
+                }
+                char block[64] = {};
+                io.write(fd, block, sizeof(block), 0, [&wrote](int64_t n) { wrote = n; });
+                auto until = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                while (wrote == 0 && std::chrono::steady_clock::now() < until) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                assert(wrote == static_cast<int64_t>(sizeof(block)));
+
+                assert(write(pipes[0][1], "x", 1) == 1);
+                io.poll(pipes[0][0], POLLIN, [&readable](int64_t r) { readable = r; });
+                until = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                while (readable == 0 && std::chrono::steady_clock::now() < until) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                assert(readable & POLLIN);
+                // Yıkıcı: hiç hazır olmayacak poll'lar drain()'i bekletmez
+            }
+            s.waitIdle();
+            assert(cancelled == kIdle - 1);  // pipes[0]'ın ilk poll'u da hazır oldu
+            for (auto& p : pipes) {
+                close(p[0]);
+                close(p[1]);
+            }
+
+            // Açık iptal: AsyncIo yaşarken
+            jts::AsyncIo io(s, few);
+            int idle[2];
+            assert(pipe(idle) == 0);
+            std::atomic<int64_t> result{0};
+            io.poll(idle[0], POLLIN, [&result](int64_t r) { result = r; });
+            io.cancelPolls();
+            io.drain();
+            s.waitIdle();
+            assert(result == -ECANCELED);
+            assert(io.inFlight() == 0);
+            close(idle[0]);
+            close(idle[1]);
+        }
+        assert(s.domainStats(jts::TaskType::IO).executed >= kBlocks + 2);
+        s.stop();
+        close(fd);
+    }
+    std::cout << "[PASS] Async IO\n";
+}
+
+#if defined(__cpp_impl_coroutine)
+jts::task<int> coroSquare(jts::Scheduler& s, int x) {
+    co_await jts::sleepFor(s, std::chrono::milliseconds(1 + x % 5));
+    co_return x * x;
+}
+
+jts::task<int> coroSumOfSquares(jts::Scheduler& s, int a, int b) {
+    int x = co_await coroSquare(s, a);
+    int y = co_await coroSquare(s, b);
+    co_return x + y;
+}
+
+jts::task<> coroFail(jts::Scheduler& s) {
+    co_await jts::sleepFor(s, std::chrono::milliseconds(1));
+    throw std::runtime_error("sensor timeout");
+}
+
+jts::task<int> coroSleepWith(jts::Scheduler& s, jts::Task desc) {
+    co_await jts::sleepFor(s, std::chrono::milliseconds(2), std::move(desc));
+    co_return 1;
+}
+
+jts::task<bool> coroHop(jts::ThreadPool& pool) {
+    std::thread::id before = std::this_thread::get_id();
+    co_await jts::resumeOn(pool);
+    co_return std::this_thread::get_id() != before;
+}
+
+jts::task<int64_t> coroPipe(jts::AsyncIo& io, int fd) {
+    int64_t revents = co_await jts::asyncPoll(io, fd, POLLIN);
+    if (revents < 0 || !(revents & POLLIN)) co_return -1;
+    char c = 0;
+    if (::read(fd, &c, 1) != 1) co_return -1;
+    co_return c;
+}
+
+jts::task<int64_t> coroFileRoundTrip(jts::AsyncIo& io, int fd) {
+    const char out[] = "jetson";
+    char in[sizeof(out)] = {};
+    int64_t n = co_await jts::asyncWrite(io, fd, out, sizeof(out), 0);
+    if (n != static_cast<int64_t>(sizeof(out))) co_return -1;
+    if (co_await jts::asyncFsync(io, fd) != 0) co_return -1;
+    jts::Task cpu;
+    cpu.name = "parse";
+    n = co_await jts::asyncRead(io, fd, in, sizeof(in), 0, cpu);
+    co_return n == static_cast<int64_t>(sizeof(out)) && std::string(in) == out ? n : -1;
+}
+
+jts::task<int> coroFsyncWith(jts::AsyncIo& io, int fd, jts::Task followUp) {
+    int resumes = 0;
+    if (co_await jts::asyncFsync(io, fd, followUp) == 0) ++resumes;
+    co_return resumes;
+}
+
+void testCoroutines() {
+    jts::ThreadPool pool(1);  // Scheduler'dan sonra yok edilir (worker'lar submit içinde olabilir)
+    jts::SchedulerOptions opts;
+    opts.cpu.workers = 2;
+    opts.io.workers = 1;
+    jts::Scheduler s(opts);
+    s.start();
+
+    // Binlerce mantıksal etkinlik iki worker'da: uyuyan coroutine worker tutmaz
+    const int kCoroutines = 2000;
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<jts::Future<int>> results;
+    results.reserve(kCoroutines);
+    for (int i = 0; i < kCoroutines; ++i) results.push_back(jts::spawn(s, coroSquare(s, i % 100)));
+    long long sum = 0;
+    for (auto& f : results) sum += f.get();
+    auto elapsed = std::chrono::steady_clock::now() - t0;
+    long long expected = 0;
+    for (int i = 0; i < kCoroutines; ++i) expected += (i % 100) * (i % 100);
+    assert(sum == expected);
+    assert(elapsed < std::chrono::seconds(2));  // Sıralı uyku ~6 s olurdu
+
+    // Görev tamamlanmasını bekleme (iç içe) ve istisna yayılımı
+    assert(jts::spawn(s, coroSumOfSquares(s, 3, 4)).get() == 25);
+    bool threw = false;
+    try {
+        jts::spawn(s, coroFail(s)).get();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Periyodik tanım tek seferlik devama çevrilir (bitmiş çerçeve yeniden
+    // sürdürülmez); kabul edilmeyen tanım Future'a / co_await'e hata verir
+    {
+        jts::Task periodic(0, "coro_periodic", jts::TaskType::CPU, 5);
+        periodic.period = std::chrono::milliseconds(1);
+        periodic.phase = std::chrono::milliseconds(1);
+        periodic.wcet = std::chrono::microseconds(100);
+        assert(jts::spawn(jts::Executor(s, periodic), coroSleepWith(s, periodic)).get() == 1);
+        s.waitIdle();
+        assert(s.registry().count() == 0);
+
+        jts::Task bad(0, "coro_bad", jts::TaskType::CPU, 5);
+        bad.cpu_cores = {70};
+        auto expectRejected = [](jts::Future<int> f) {
+            bool rejected = false;
+            try {
+                f.get();
+            } catch (const std::invalid_argument&) {
+                rejected = true;
+            }
+            assert(rejected);
+        };
+        expectRejected(jts::spawn(jts::Executor(s, bad), coroSquare(s, 2)));
+        expectRejected(jts::spawn(s, coroSleepWith(s, bad)));
+    }
+
+    // Askıdayken worker serbest: tek worker'da sonradan eklenen görev önce biter
+    {
+        jts::SchedulerOptions one;
+        one.cpu.workers = 1;
+        jts::Scheduler single(one);
+        single.start();
+        std::atomic<int> order{0};
+        int coroAt = -1;
+        int taskAt = -1;
+        auto sleeper = [](jts::Scheduler& sc, std::atomic<int>& ord, int& at) -> jts::task<> {
+            co_await jts::sleepFor(sc, std::chrono::milliseconds(30));
+            at = ord++;
+        };
+        auto done = jts::spawn(single, sleeper(single, order, coroAt));
+        auto quick = single.submit(jts::Task(0, "quick", jts::TaskType::CPU, 5),
+                                   [&]() { taskAt = order++; });
+        quick.get();
+        done.get();
+        assert(taskAt == 0 && coroAt == 1);
+        single.stop();
+    }
+
+    // Yürütücü değiştirme: devam ThreadPool thread'inde
+    assert(jts::spawn(s, coroHop(pool)).get());
+
+    // IO hazır olma ve dosya işlemleri, iki arka uçta
+    for (bool fallback : {false, true}) {
+        jts::AsyncIoOptions ioOpts;
+        ioOpts.forceFallback = fallback;
+        jts::AsyncIo io(s, ioOpts);
+
+        int fds[2];
+        assert(pipe(fds) == 0);
+        auto byte = jts::spawn(s, coroPipe(io, fds[0]));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        assert(!byte.ready());  // Veri yok: poll'da askıda
+        assert(write(fds[1], "x", 1) == 1);
+        assert(byte.get() == 'x');
+        close(fds[0]);
+        close(fds[1]);
+
+        char path[] = "/tmp/jts_coro_XXXXXX";
+        int fd = mkstemp(path);
+        assert(fd >= 0);
+        unlink(path);
+        assert(jts::spawn(s, coroFileRoundTrip(io, fd)).get() == 7);
+
+        // Periyodik devam tanımı tek seferliktir; kabul edilmeyen tanım
+        // IO gönderilmeden co_await'te fırlar (coroutine askıda kalmaz)
+        jts::Task periodic(0, "io_periodic", jts::TaskType::CPU, 5);
+        periodic.period = std::chrono::milliseconds(1);
+        periodic.wcet = std::chrono::microseconds(100);
+        assert(jts::spawn(s, coroFsyncWith(io, fd, periodic)).get() == 1);
+        s.waitIdle();
+        assert(s.registry().count() == 0);
+        jts::Task bad(0, "io_bad", jts::TaskType::CPU, 5);
+        bad.cpu_cores = {5000};
+        bool rejected = false;
+        try {
+            jts::spawn(s, coroFsyncWith(io, fd, bad)).get();
+        } catch (const std::invalid_argument&) {
+            rejected = true;
+        }
+        assert(rejected);
+        assert(io.rejectedFollowUps() == 0);
+        close(fd);
+        io.drain();
+    }
+
+    s.waitIdle();
+    s.stop();
+    std::cout << "[PASS] Coroutines\n";
+}
+#endif
+
+void testTaskGraph() {
+    // camera -> inference -> {tracking, logger} -> decision
+    jts::TaskGraph g;
+    std::atomic<int> clock{0};
+    int at[5];
+    auto stamp = [&clock, &at](int i) { return [&clock, &at, i]() { at[i] = clock++; }; };
+    auto cam = g.addNode("camera", stamp(0));
+    auto ai = g.addNode("inference", stamp(1));
+    auto track = g.addNode("tracking", stamp(2));
+    auto log = g.addNode("logger", stamp(3));
+    auto decide = g.addNode("decision", stamp(4));
+    assert(g.addEdge(cam, ai));
+    assert(g.addEdge(ai, track));
+    assert(g.addEdge(ai, log));
+    assert(g.addEdge(track, decide));
+    assert(g.addEdge(log, decide));
+    assert(!g.addEdge(decide, cam));  // Döngü
+    assert(!g.addEdge(cam, ai));      // Tekrar
+
+    auto checkOrder = [&]() {
+        assert(at[0] < at[1]);
+        assert(at[1] < at[2] && at[1] < at[3]);
+        assert(at[2] < at[4] && at[3] < at[4]);
+    };
+
+    {
+        jts::ThreadPool pool(3);
+        for (int frame = 0; frame < 20; ++frame) {  // Aynı graf her karede
+            assert(g.run(pool));
+            checkOrder();
+        }
+    }
+
+    jts::Scheduler inlineSched;      // start() yok: bu thread'de yürütülür
+    assert(g.run(inlineSched));
+    checkOrder();
+
+    jts::Scheduler multi(2);
+    multi.start();
+    assert(g.run(multi));
+    checkOrder();
+    multi.stop();
+
+    assert(g.runs() == 22);
+    assert(clock == 22 * 5);
+
+    // Fırlatan düğüm: run() takılmaz, ardıl yine çalışır, istisna run()'dan gelir
+    jts::TaskGraph bad;
+    std::atomic<int> after{0};
+    auto boom = bad.addNode("boom", []() { throw std::runtime_error("node failed"); });
+    auto next = bad.addNode("next", [&after]() { after++; });
+    assert(bad.addEdge(boom, next));
+    auto expectThrow = [&bad](auto& runner) {
+        bool thrown = false;
+        try {
+            bad.run(runner);
+        } catch (const std::runtime_error& e) {
+            thrown = std::string(e.what()) == "node failed";
+        }
+        assert(thrown);
+    };
+    {
+        jts::ThreadPool pool(2);
+        expectThrow(pool);
+    }
+    jts::Scheduler inlineBad;
+    expectThrow(inlineBad);
+    jts::Scheduler multiBad(2);
+    multiBad.start();
+    expectThrow(multiBad);
+    multiBad.stop();
+    assert(after == 3 && bad.runs() == 3);
+
+    // Reddedilen düğüm (cpu_cores aralık dışı) takılmaz, ardılı çalışır;
+    // phase/period'lu düğüm tek seferlik ve hemen çalışır
+    jts::TaskGraph odd;
+    std::atomic<int> delayedRuns{0};
+    std::atomic<int> tailRuns{0};
+    jts::Task rejected;
+    rejected.name = "rejected";
+    rejected.cpu_cores = {5000};
+    jts::Task delayed;
+    delayed.name = "delayed";
+    delayed.phase = std::chrono::milliseconds(5);
+    delayed.period = std::chrono::milliseconds(1);
+    auto rej = odd.addNode(rejected, []() { assert(false); });
+    auto del = odd.addNode(delayed, [&delayedRuns]() { delayedRuns++; });
+    auto tail = odd.addNode("tail", [&tailRuns]() { tailRuns++; });
+    assert(odd.addEdge(rej, tail));
+    assert(odd.addEdge(del, tail));
+    auto expectRejected = [&odd](jts::Scheduler& sc) {
+        bool thrown = false;
+        try {
+            odd.run(sc);
+        } catch (const std::runtime_error& e) {
+            thrown = std::string(e.what()).find("rejected") != std::string::npos;
+        }
+        assert(thrown);
+    };
+    jts::Scheduler inlineOdd;
+    expectRejected(inlineOdd);
+    assert(inlineOdd.registry().activeCount() == 0);
+    jts::Scheduler multiOdd(2);
+    multiOdd.start();
+    expectRejected(multiOdd);
+    multiOdd.waitIdle();
+    multiOdd.stop();
+    assert(delayedRuns == 2 && tailRuns == 2);
+
+    jts::TaskGraph slow;
+    slow.addNode(delayed, [&delayedRuns]() { delayedRuns++; });
+    jts::Scheduler inlineSlow;
+    assert(slow.run(inlineSlow));
+    assert(delayedRuns == 3 && inlineSlow.registry().activeCount() == 0);
+    std::cout << "[PASS] Task graph\n";
+}
+
+void testPipeline() {
+    jts::MetricsCollector metrics;
+    std::atomic<long> sum{0};
+    {
+        // Block: kayıpsız; ortadaki aşama 2 worker (MPMC)
+        jts::Pipeline<int> p(&metrics);
+        p.addStage("decode", [](int& v) { v *= 2; return true; }, {-1, 1, 4});
+        p.addStage("filter", [](int& v) { return v % 4 == 0; }, {-1, 2, 4});
+        p.addStage("sink", [&sum](int& v) { sum += v; return true; }, {-1, 1, 4});
+        p.start();
+        for (int i = 1; i <= 1000; ++i) assert(p.push(i));
+        p.stop();
+        assert(!p.push(1));
+
+        auto st = p.stats();
+        assert(st[0].processed == 1000 && st[0].dropped == 0);
+        assert(st[1].processed == 1000 && st[1].filtered == 500);
+        assert(st[2].processed == 500);
+        // Çift i'ler: 2 * (2 + 4 + ... + 1000)
+        assert(sum == 2 * 250500);
+    }
+
+    // Yavaş tüketici + küçük kuyruk: düşürme politikaları kayıp sayar
+    for (auto policy : {jts::OverflowPolicy::DropNewest, jts::OverflowPolicy::DropOldest}) {
+        jts::Pipeline<int> p;
+        jts::StageOptions opt;
+        opt.capacity = 2;
+        opt.overflow = policy;
+        p.addStage("slow", [](int&) {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            return true;
+        }, opt);
+        p.start();
+        for (int i = 0; i < 200; ++i) p.push(i);
+        p.stop();
+        auto st = p.stats();
+        assert(st[0].dropped > 0);
+        assert(st[0].processed + st[0].dropped == 200);
+    }
+
+    // Metrik: aşama adıyla adet ve kuyruk derinliği göstergesi
+    bool sawStage = false, sawGauge = false;
+    for (const auto& s : metrics.latencyStats()) {
+        if (s.task_name == "decode" && s.count == 1000) sawStage = true;
+    }
+    for (const auto& g : metrics.gaugeStats()) {
+        if (g.name == "filter.queue" && g.samples == 1000 && g.max <= 4) sawGauge = true;
+    }
+    assert(sawStage && sawGauge);
+    std::cout << "[PASS] Pipeline\n";
+}
+
+void testFutures() {
+    // ThreadPool: değer, istisna, bariyer
+    {
+        jts::ThreadPool pool(2);
+        auto answer = pool.submit([]() { return 6 * 7; });
+        auto failed = pool.submit([]() -> int { throw std::runtime_error("boom"); });
+        assert(answer.get() == 42);
+        bool threw = false;
+        try {
+            failed.get();
+        } catch (const std::runtime_error& e) {
+            threw = std::string(e.what()) == "boom";
+        }
+        assert(threw);
+
+        std::atomic<int> done{0};
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&done]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                done++;
+            });
+        }
+        pool.waitIdle();
+        assert(done == 100 && pool.pending() == 0);
+    }
+
+    // WorkStealingPool: iç içe submit dahil hepsi bariyerden önce biter
+    {
+        jts::WorkStealingPool pool(2);
+        std::atomic<int> done{0};
+        std::vector<jts::Future<void>> outer;
+        for (int i = 0; i < 20; ++i) {
+            outer.push_back(pool.submit([&pool, &done]() {
+                for (int k = 0; k < 5; ++k) pool.submit([&done]() { done++; });
+            }));
+        }
+        jts::waitAll(outer);
+        pool.waitIdle();
+        assert(done == 100);
+    }
+
+    // Future zaman aşımı: hiç kurulmayan sonuç
+    jts::Promise<int> never;
+    auto pending = never.getFuture();
+    assert(!pending.ready() && !pending.waitFor(std::chrono::milliseconds(5)));
+
+    // Scheduler: submit sonucu, ID ile toplu bekleme, süreli bekleme
+    {
+        jts::Scheduler s(2);
+        s.start();
+        jts::Task t;
+        t.name = "answer";
+        auto f = s.submit(t, []() { return std::string("ok"); });
+
+        std::atomic<int> ran{0};
+        std::vector<uint64_t> ids;
+        for (int i = 0; i < 10; ++i) {
+            t.name = "batch";
+            ids.push_back(s.addTask(t, [&ran]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                ran++;
+            }));
+        }
+        s.wait(ids);
+        assert(ran == 10);
+        assert(f.get() == "ok");
+
+        // Periyodik görev iptal edilene kadar bitmez
+        jts::Task periodic;
+        periodic.name = "tick";
+        periodic.period = std::chrono::milliseconds(2);
+        uint64_t tick = s.addTask(periodic, []() {});
+        assert(!s.waitFor({tick}, std::chrono::milliseconds(20)));
+        assert(s.cancelTask(tick));
+        assert(s.waitFor({tick}, std::chrono::milliseconds(1000)));
+        s.waitIdle();
+        assert(s.pendingCount() == 0);
+        s.stop();
+    }
+
+    // start() yokken bekleme görevleri bu thread'de yürütür
+    {
+        jts::Scheduler inlineSched;
+        int ran = 0;
+        jts::Task t;
+        t.name = "inline";
+        for (int i = 0; i < 3; ++i) inlineSched.addTask(t, [&ran]() { ran++; });
+        inlineSched.waitIdle();
+        assert(ran == 3);
+    }
+    std::cout << "[PASS] Futures and completion waits\n";
+}
+
+void testBatchSubmission() {
+    jts::ThreadPool pool(3);
+
+    std::atomic<int> done{0};
+    std::vector<std::function<void()>> jobs;
+    for (int i = 0; i < 1000; ++i) jobs.push_back([&done]() { done++; });
+    pool.submitBulk(std::move(jobs));
+    pool.waitIdle();
+    assert(done == 1000);
+
+    // Fırlatan toplu iş süreci sonlandırmaz; kalanlar çalışır
+    jobs.clear();
+    for (int i = 0; i < 10; ++i) {
+        jobs.push_back([&done, i]() {
+            if (i % 3 == 0) throw std::runtime_error("bulk job failed");
+            done++;
+        });
+    }
+    pool.submitBulk(std::move(jobs));
+    pool.waitIdle();
+    assert(done == 1006);
+    assert(pool.submit([]() { return 7; }).get() == 7);
+
+    // Otomatik ve açık grain, tek parçalı ve boş aralık
+    std::vector<int> out(10007, 0);
+    for (size_t grain : {size_t(0), size_t(7), size_t(100000)}) {
+        std::fill(out.begin(), out.end(), 0);
+        pool.parallelFor(0, out.size(), grain, [&out](size_t i) { out[i] += static_cast<int>(i); });
+        for (size_t i = 0; i < out.size(); ++i) assert(out[i] == static_cast<int>(i));
+    }
+    pool.parallelFor(5, 5, 0, [](size_t) { assert(false); });
+
+    // İstisna çağırana taşınır
+    bool threw = false;
+    try {
+        pool.parallelFor(0, 100, 1, [](size_t i) {
+            if (i == 42) throw std::runtime_error("tile");
+        });
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Havuz içinden (tek worker): çağıran thread parçaları kendisi bitirir
+    {
+        jts::ThreadPool single(1);
+        std::atomic<int> inner{0};
+        auto f = single.submit([&single, &inner]() {
+            single.parallelFor(0, 64, 4, [&inner](size_t) { inner++; });
+        });
+        f.get();
+        assert(inner == 64);
+    }
+
+    // Registry: ardışık ID'ler, tek kilitte sıralı kayıt
+    jts::TaskRegistry reg;
+    std::vector<jts::Task> batch(5);
+    for (int i = 0; i < 5; ++i) batch[i].priority = i;
+    auto ids = reg.registerTasks(batch);
+    assert(ids.size() == 5 && reg.count() == 5);
+    for (size_t i = 1; i < ids.size(); ++i) assert(ids[i] == ids[i - 1] + 1);
+    assert(reg.popHighest()->id == ids[4]);
+
+    // Scheduler: toplu ekle, ID'lerle bekle
+    jts::Scheduler s(2);
+    s.start();
+    std::atomic<int> ran{0};
+    std::vector<jts::Task> tiles(64);
+    for (auto& t : tiles) {
+        t.name = "tile";
+        t.work = [&ran]() { ran++; };
+    }
+    s.wait(s.addTasks(std::move(tiles)));
+    assert(ran == 64);
+    s.stop();
+    std::cout << "[PASS] Batch submission and parallelFor\n";
+}
+
+// Fixture sysfs ağacına dosya yaz (ara dizinler oluşturulur)
+void writeSysFile(const std::string& root, const std::string& rel, const std::string& text) {
+    std::string path = root + "/" + rel;
+    for (size_t pos = root.size() + 1; (pos = path.find('/', pos)) != std::string::npos; ++pos) {
+        mkdir(path.substr(0, pos).c_str(), 0755);
+    }
+    std::ofstream(path) << text << "\n";
+}
+
+void testThreadPoolPriority() {
+    // Tek worker bir kapıda tutulur, işler sıraya girer, kapı açılınca
+    // çalışma sırası kaydedilir
+    auto runOrdered = [](std::chrono::microseconds aging,
+                         const std::function<void(jts::ThreadPool&, std::vector<std::string>&)>& fill) {
+        jts::ThreadPool pool(1, aging);
+        std::vector<std::string> order;
+        jts::Promise<void> gate;
+        jts::Future<void> opened = gate.getFuture();
+        pool.submit(jts::ThreadPool::kMaxPriority, true, [opened]() { opened.wait(); });
+        while (pool.pending() != 0) std::this_thread::yield();  // Worker kapıda
+        fill(pool, order);
+        gate.setValue();
+        pool.waitIdle();
+        return order;
+    };
+    auto add = [](jts::ThreadPool& pool, std::vector<std::string>& order,
+                  int priority, bool realtime, const std::string& name) {
+        pool.submit(priority, realtime, [&order, name]() { order.push_back(name); });
+    };
+
+    // Katı öncelik: düşük iş yığını sonradan gelen yükseği geciktirmez
+    auto strict = runOrdered(std::chrono::microseconds(0), [&](jts::ThreadPool& pool,
+                                                             std::vector<std::string>& order) {
+        for (int i = 0; i < 3; ++i) add(pool, order, 1, false, "log" + std::to_string(i));
+        add(pool, order, 9, false, "inference");
+        add(pool, order, 2, true, "control");
+        add(pool, order, 42, false, "clamped");  // 10'a çekilir
+        assert(pool.pending() == 6);
+        assert(pool.pending(1) == 3);
+        assert(pool.pending(10) == 1);
+        assert(pool.pending(0, true) == 1);
+        assert(pool.pending(jts::ThreadPool::kDefaultPriority) == 0);
+    });
+    assert((strict == std::vector<std::string>{"control", "clamped", "inference",
+                                               "log0", "log1", "log2"}));
+
+    // Yaşlanma: 1 ms adım, 20 ms bekleyen priority 0 iş seviye 10'a ulaşır ve
+    // daha eski olduğu için yeni gelen priority 10 işlerin önüne geçer;
+    // realtime yine de önce
+    auto aged = runOrdered(std::chrono::microseconds(1000), [&](jts::ThreadPool& pool,
+                                                                std::vector<std::string>& order) {
+        add(pool, order, 0, false, "old_low");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        add(pool, order, 10, false, "high0");
+        add(pool, order, 10, false, "high1");
+        add(pool, order, 0, true, "rt");
+    });
+    assert((aged == std::vector<std::string>{"rt", "old_low", "high0", "high1"}));
+
+    // Öncelikli bir işin içinden parallelFor: yardımcılar çağıranın şeridine girer
+    jts::ThreadPool pool(2);
+    std::atomic<size_t> sum{0};
+    pool.submit(3, [&pool, &sum]() {
+        pool.parallelFor(0, 100, 1, [&sum](size_t i) { sum += i; });
+    }).get();
+    assert(sum == 4950);
+    std::cout << "[PASS] ThreadPool priority lanes\n";
+}
+
+void testElasticPool() {
+    // Esnek boyut: 1..4 worker, boşta 20 ms sonra fazlası kapanır
+    jts::PoolOptions options;
+    options.minThreads = 1;
+    options.maxThreads = 4;
+    options.idleTimeout = std::chrono::milliseconds(20);
+    jts::ThreadPool pool(options);
+    assert(pool.size() == 1 && pool.minThreads() == 1 && pool.maxThreads() == 4);
+
+    // Birbirini bekleyen 4 iş: ancak 4 worker açılırsa hepsi aynı anda çalışır
+    std::atomic<int> arrived{0};
+    std::vector<jts::Future<void>> all;
+    for (int i = 0; i < 4; ++i) {
+        all.push_back(pool.submit([&arrived]() {
+            arrived++;
+            while (arrived < 4) std::this_thread::yield();
+        }));
+    }
+    jts::waitAll(all);
+    assert(pool.size() == 4);
+
+    // Fazla worker'lar idleTimeout sonunda çıkar, en az minThreads kalır
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.size() > 1 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    assert(pool.size() == 1);
+
+    // Çıkan yuvalar yeniden kullanılır; iç içe submit büyümeyi tetikler
+    std::atomic<int> done{0};
+    for (int i = 0; i < 50; ++i) {
+        pool.submit([&pool, &done]() {
+            pool.submit([&done]() { done++; });
+            done++;
+        });
+    }
+    pool.waitIdle();
+    assert(done == 100);
+    assert(pool.size() >= 1 && pool.size() <= 4);
+
+    // Spin: dönen worker'lar işi futex uyandırması olmadan alır; sonuçlar aynı
+    jts::PoolOptions spinning;
+    spinning.minThreads = 2;
+    spinning.spin = std::chrono::microseconds(200);
+    jts::ThreadPool fast(spinning);
+    int sum = 0;
+    for (int i = 0; i < 200; ++i) {
+        sum += fast.submit([i]() { return i; }).get();
+    }
+    assert(sum == 199 * 200 / 2);
+    fast.parallelFor(0, 1000, 0, [&done](size_t) { done++; });
+    assert(done == 1100);
+    fast.shutdown();
+    assert(fast.size() == 0);
+    std::cout << "[PASS] Elastic pool / spin-then-park\n";
+}
+
+void testTopology() {
+    auto list = jts::parseCpuList("0-2,5,,7-8,x");
+    assert((list == std::vector<int>{0, 1, 2, 5, 7, 8}));
+
+    char jetsonDir[] = "/tmp/jts_topo_XXXXXX";
+    assert(mkdtemp(jetsonDir));
+    const std::string jetson = jetsonDir;
+
+    // Jetson tarzı: iki küme, küme başına paylaşılan L2, ortak L3;
+    // cpu6 çevrim dışı, cpu7 izole
+    writeSysFile(jetson, "devices/system/cpu/online", "0-5,7");
+    writeSysFile(jetson, "devices/system/cpu/isolated", "7");
+    for (int id : {0, 1, 2, 3, 4, 5, 7}) {
+        std::string base = "devices/system/cpu/cpu" + std::to_string(id);
+        writeSysFile(jetson, base + "/topology/physical_package_id", "0");
+        writeSysFile(jetson, base + "/topology/cluster_id", id < 4 ? "0" : "1");
+        writeSysFile(jetson, base + "/topology/core_id", std::to_string(id % 4));
+        writeSysFile(jetson, base + "/cache/index0/level", "1");
+        writeSysFile(jetson, base + "/cache/index0/type", "Data");
+        writeSysFile(jetson, base + "/cache/index0/shared_cpu_list", std::to_string(id));
+        writeSysFile(jetson, base + "/cache/index1/level", "2");
+        writeSysFile(jetson, base + "/cache/index1/type", "Unified");
+        writeSysFile(jetson, base + "/cache/index1/shared_cpu_list", id < 4 ? "0-3" : "4-7");
+        writeSysFile(jetson, base + "/cache/index2/level", "3");
+        writeSysFile(jetson, base + "/cache/index2/type", "Unified");
+        writeSysFile(jetson, base + "/cache/index2/shared_cpu_list", "0-7");
+    }
+    writeSysFile(jetson, "devices/system/node/node0/cpulist", "0-7");
+
+    auto topo = jts::Topology::discover(jetson);
+    assert(topo.size() == 7 && topo.nodeCount() == 1);
+    assert(topo.online(5) && !topo.online(6) && topo.isolated(7));
+    assert(topo.cpu(4)->cluster == 1 && topo.cpu(4)->l2 == 4 && topo.cpu(4)->l3 == 0);
+    auto groups = topo.cacheGroups();
+    assert(groups.size() == 2);
+    assert((groups[0] == std::vector<int>{0, 1, 2, 3}));
+    assert((groups[1] == std::vector<int>{4, 5, 7}));
+    assert(topo.sameCacheGroup(0, 3) && !topo.sameCacheGroup(3, 4));
+    // İzole CPU en sonda, fazlası baştan
+    assert((topo.placement(8) == std::vector<int>{0, 1, 2, 3, 4, 5, 7, 0}));
+
+    jts::Task t;
+    t.name = "pinned";
+    t.cpu_cores = {7};
+    assert(t.isValid(topo));
+    t.cpu_cores = {6};
+    assert(!t.isValid(topo));
+
+    // x86 tarzı SMT: L2 sadece kardeş thread'lerle paylaşılır -> grup L3;
+    // iki NUMA düğümü
+    char x86Dir[] = "/tmp/jts_topo_XXXXXX";
+    assert(mkdtemp(x86Dir));
+    const std::string x86 = x86Dir;
+    writeSysFile(x86, "devices/system/cpu/online", "0-3");
+    for (int id = 0; id < 4; ++id) {
+        std::string base = "devices/system/cpu/cpu" + std::to_string(id);
+        writeSysFile(x86, base + "/topology/physical_package_id", "0");
+        writeSysFile(x86, base + "/topology/core_id", std::to_string(id % 2));
+        writeSysFile(x86, base + "/cache/index0/level", "2");
+        writeSysFile(x86, base + "/cache/index0/shared_cpu_list", id % 2 ? "1,3" : "0,2");
+        writeSysFile(x86, base + "/cache/index1/level", "3");
+        writeSysFile(x86, base + "/cache/index1/shared_cpu_list", "0-3");
+    }
+    writeSysFile(x86, "devices/system/node/node0/cpulist", "0-1");
+    writeSysFile(x86, "devices/system/node/node1/cpulist", "2-3");
+    auto smt = jts::Topology::discover(x86);
+    assert(smt.size() == 4 && smt.nodeCount() == 2);
+    assert(smt.cpu(3)->node == 1 && smt.cpu(2)->core == 0);
+    assert(smt.cacheGroups().size() == 2);  // Düğüm başına bir L3 grubu
+    assert((smt.placement(4) == std::vector<int>{0, 1, 2, 3}));
+
+    // sysfs yoksa düz topoloji
+    auto flat = jts::Topology::discover(jetson + "/missing");
+    assert(flat.size() == static_cast<size_t>(sysconf(_SC_NPROCESSORS_ONLN)));
+    assert(flat.cacheGroups().size() == 1);
+
+    // Canlı sistem: getCpuCount ile tutarlı, boş çekirdek listesi geçerli
+    assert(jts::getCpuCount() == static_cast<int>(jts::Topology::system().size()));
+    jts::Task any;
+    any.name = "any";
+    assert(any.isValid());
+
+    std::string cleanup = "rm -rf " + jetson + " " + x86;
+    assert(std::system(cleanup.c_str()) == 0);
+    std::cout << "[PASS] Topology\n";
+}
+
 int main() {
     std::cout << "=== Unit Tests ===\n";
     testTaskCreation();
     testRegistry();
+    testRegistryPopOrder();
+    testMultiWorkerAffinity();
+    testExecutionDomains();
+    testWorkStealingPool();
+    testEdfOrder();
+    testPeriodicTask();
+    testAdmissionControl();
+    testTimingWheel();
+    testDelayedTasks();
+    testMetricsRings();
+    testHistogramPercentiles();
+    testLatencyWindow();
+    testChromeTrace();
+    testAsyncLogger();
+    testZeroAllocScheduling();
+    testAsyncIo();
+#if defined(__cpp_impl_coroutine)
+    testCoroutines();
+#endif
+    testTaskGraph();
+    testPipeline();
+    testFutures();
+    testBatchSubmission();
+    testThreadPoolPriority();
+    testElasticPool();
+    testTopology();
     std::cout << "All tests passed!\n";
     return 0;
 }
\ No newline at end of file